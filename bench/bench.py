@@ -8,12 +8,16 @@ from pathlib import Path
 
 from benchlib.common import read_manifest, validate_comparison_manifests
 from benchlib.evaluation import (
+    EVALUATION_PROFILE_FORMAT,
     EVALUATION_THROUGHPUT_FORMAT,
     add_evaluation_parser,
+    add_evaluation_profile_run_parser,
     add_evaluation_run_parser,
     command_evaluation,
     command_run_evaluation,
+    command_run_evaluation_profile,
     render_evaluation_compare,
+    render_evaluation_profile_compare,
 )
 from benchlib.match import add_match_parser, command_run_match
 from benchlib.perft import PERFT_FORMAT, add_perft_parser, command_run_perft, render_perft_compare
@@ -34,6 +38,7 @@ def parse_args() -> argparse.Namespace:
     add_search_parser(run_subparsers)
     add_perft_parser(run_subparsers)
     add_evaluation_run_parser(run_subparsers)
+    add_evaluation_profile_run_parser(run_subparsers)
     add_match_parser(run_subparsers)
 
     add_evaluation_parser(subparsers)
@@ -61,7 +66,7 @@ def command_compare(args: argparse.Namespace) -> int:
             "selected_positions",
         )
     elif old_format == PERFT_FORMAT:
-        suite_fields = ("profile",)
+        suite_fields = ("profile", "threads", "hash_mb")
     elif old_format == EVALUATION_THROUGHPUT_FORMAT:
         suite_fields = (
             "corpus_sha256",
@@ -71,6 +76,16 @@ def command_compare(args: argparse.Namespace) -> int:
             "repetitions",
             "samples",
         )
+    elif old_format == EVALUATION_PROFILE_FORMAT:
+        suite_fields = (
+            "corpus_sha256",
+            "corpus_version",
+            "corpus_size",
+            "warmup_repetitions",
+            "repetitions",
+            "samples",
+            "tick_unit",
+        )
     else:
         suite_fields = ()
 
@@ -83,6 +98,10 @@ def command_compare(args: argparse.Namespace) -> int:
         content = render_perft_compare(baseline, candidate, old_manifest, new_manifest)
     elif old_format == EVALUATION_THROUGHPUT_FORMAT:
         content = render_evaluation_compare(baseline, candidate, old_manifest, new_manifest)
+    elif old_format == EVALUATION_PROFILE_FORMAT:
+        content = render_evaluation_profile_compare(
+            baseline, candidate, old_manifest, new_manifest
+        )
     else:
         raise ValueError(f"compare is not supported for result format: {old_format}")
     output.parent.mkdir(parents=True, exist_ok=True)
@@ -103,6 +122,8 @@ def main() -> int:
         return command_run_perft(args)
     if args.suite == "eval":
         return command_run_evaluation(args)
+    if args.suite == "eval-profile":
+        return command_run_evaluation_profile(args)
     if args.suite == "match":
         return command_run_match(args)
     raise ValueError(f"unknown suite: {args.suite}")
@@ -28,6 +28,8 @@ from .common import (
 EVALUATION_CORPUS = BENCH_DIR / "eval/corpus.tsv"
 EVALUATION_BASELINE = BENCH_DIR / "eval/baseline.tsv"
 EVALUATION_THROUGHPUT_FORMAT = "evaluation_throughput_v1"
+EVALUATION_PROFILE_FORMAT = "evaluation_profile_v1"
+EVALUATION_PROFILE_BUILD_PRESET = "release-eval-profile"
 
 EVALUATION_THROUGHPUT_COLUMNS = [
     "result_format",
@@ -46,6 +48,41 @@ EVALUATION_THROUGHPUT_COLUMNS = [
     "evaluations_per_second",
 ]
 
+EVALUATION_PROFILE_COLUMNS = [
+    "result_format",
+    "corpus_version",
+    "compiler",
+    "build_mode",
+    "tick_unit",
+    "sample",
+    "samples",
+    "corpus_size",
+    "warmup_repetitions",
+    "repetitions",
+    "evaluations",
+    "term",
+    "calls",
+    "ticks",
+    "ticks_per_call",
+    "ticks_per_evaluation",
+]
+
+# Rows of each profile sample, in output order.
+EVALUATION_PROFILE_TERMS = [
+    "material",
+    "squares",
+    "pawns",
+    "knights",
+    "bishops",
+    "rooks",
+    "queens",
+    "king",
+    "mobility",
+    "threats",
+    "other",
+    "evaluation",
+]
+
 
 def add_evaluation_parser(
     subparsers: argparse._SubParsersAction[argparse.ArgumentParser],
@@ -83,6 +120,23 @@ def add_evaluation_run_parser(
     )
 
 
+def add_evaluation_profile_run_parser(
+    subparsers: argparse._SubParsersAction[argparse.ArgumentParser],
+) -> None:
+    parser = subparsers.add_parser(
+        "eval-profile", help="measure evaluation cost per term in a profiling build"
+    )
+    add_common_run_args(parser, build_preset=EVALUATION_PROFILE_BUILD_PRESET)
+    parser.add_argument("--warmup", type=int)
+    parser.add_argument("--repetitions", type=int)
+    parser.add_argument("--samples", type=int)
+    parser.add_argument(
+        "--benchmark",
+        type=Path,
+        help="benchmark binary built with LATRUNCULI_EVAL_PROFILE; bypasses the configured build",
+    )
+
+
 def command_evaluation(args: argparse.Namespace) -> int:
     benchmark = resolve_benchmark(args)
     command = [
@@ -163,6 +217,58 @@ def command_run_evaluation(args: argparse.Namespace) -> int:
     return 0
 
 
+def command_run_evaluation_profile(args: argparse.Namespace) -> int:
+    benchmark = resolve_benchmark(args)
+    corpus = EVALUATION_CORPUS.resolve()
+    command = [
+        str(benchmark),
+        "eval",
+        "profile",
+        "--corpus",
+        str(corpus),
+    ]
+    for option, value in (
+        ("--warmup", args.warmup),
+        ("--repetitions", args.repetitions),
+        ("--samples", args.samples),
+    ):
+        if value is not None:
+            command.extend((option, str(value)))
+
+    stdout, stderr = run_capture(command, cwd=args.repo)
+    rows = parse_profile_rows(stdout)
+    first = rows[0]
+
+    run_dir = make_run_dir(args.output_root, args.label)
+    (run_dir / "raw" / "benchmark.stdout").write_text(stdout, encoding="utf-8")
+    (run_dir / "raw" / "benchmark.stderr").write_text(stderr, encoding="utf-8")
+
+    manifest = base_manifest(args, run_dir, EVALUATION_PROFILE_FORMAT)
+    manifest.update(
+        {
+            "benchmark_path": str(benchmark),
+            "command": command,
+            "corpus_path": str(corpus),
+            "corpus_sha256": hashlib.sha256(corpus.read_bytes()).hexdigest(),
+            "corpus_version": first["corpus_version"],
+            "corpus_size": int(first["corpus_size"]),
+            "warmup_repetitions": int(first["warmup_repetitions"]),
+            "repetitions": int(first["repetitions"]),
+            "samples": int(first["samples"]),
+            "tick_unit": first["tick_unit"],
+            "compiler": first["compiler"],
+            "build_mode": first["build_mode"],
+        }
+    )
+    write_tsv(run_dir / "results.tsv", rows, EVALUATION_PROFILE_COLUMNS)
+    write_manifest(run_dir / "manifest.json", manifest)
+    (run_dir / "summary.md").write_text(
+        render_evaluation_profile_summary(manifest, rows), encoding="utf-8"
+    )
+    print(run_dir)
+    return 0
+
+
 def resolve_benchmark(args: argparse.Namespace) -> Path:
     if args.benchmark is not None:
         benchmark = args.benchmark.expanduser().resolve()
@@ -251,6 +357,70 @@ def validate_evaluation_rows(rows: list[dict[str, str]]) -> None:
         raise RuntimeError("evaluation benchmark produced an inconsistent evaluation count")
 
 
+def parse_profile_rows(output: str) -> list[dict[str, str]]:
+    reader = csv.DictReader(output.splitlines(), delimiter="\t")
+    if reader.fieldnames != EVALUATION_PROFILE_COLUMNS:
+        raise RuntimeError("evaluation profile produced unexpected TSV header")
+    rows = [dict(row) for row in reader]
+    validate_profile_rows(rows)
+    return rows
+
+
+def validate_profile_rows(rows: list[dict[str, str]]) -> None:
+    if not rows:
+        raise RuntimeError("evaluation profile produced no TSV rows")
+
+    constant_fields = (
+        "corpus_version",
+        "compiler",
+        "build_mode",
+        "tick_unit",
+        "samples",
+        "corpus_size",
+        "warmup_repetitions",
+        "repetitions",
+        "evaluations",
+    )
+    first = rows[0]
+    terms = len(EVALUATION_PROFILE_TERMS)
+    try:
+        samples = int(first["samples"])
+        corpus_size = int(first["corpus_size"])
+        repetitions = int(first["repetitions"])
+        evaluations = int(first["evaluations"])
+        for index, row in enumerate(rows):
+            if row["result_format"] != EVALUATION_PROFILE_FORMAT:
+                raise RuntimeError("evaluation profile produced unexpected result format")
+            for field in constant_fields:
+                if row[field] != first[field]:
+                    raise RuntimeError(f"evaluation profile produced inconsistent {field}")
+            if int(row["sample"]) != index // terms + 1:
+                raise RuntimeError("evaluation profile produced an invalid sample sequence")
+            if row["term"] != EVALUATION_PROFILE_TERMS[index % terms]:
+                raise RuntimeError("evaluation profile produced an unexpected term sequence")
+            int(row["calls"])
+            int(row["ticks"])
+            float(row["ticks_per_evaluation"])
+    except (KeyError, ValueError) as error:
+        raise RuntimeError("evaluation profile produced invalid fields") from error
+
+    if samples == 0 or samples * terms != len(rows):
+        raise RuntimeError("evaluation profile produced an inconsistent sample count")
+    if corpus_size == 0 or repetitions == 0 or evaluations != corpus_size * repetitions:
+        raise RuntimeError("evaluation profile produced an inconsistent evaluation count")
+
+
+def term_distributions(
+    rows: list[dict[str, str]],
+) -> dict[str, tuple[float, float, float]]:
+    return {
+        term: metric_distribution(
+            [row for row in rows if row["term"] == term], "ticks_per_evaluation"
+        )
+        for term in EVALUATION_PROFILE_TERMS
+    }
+
+
 def metric_distribution(rows: list[dict[str, str]], field: str) -> tuple[float, float, float]:
     values = [float(row[field]) for row in rows]
     middle = median(values)
@@ -345,3 +515,77 @@ def render_evaluation_compare(
         ),
     ]
     return "\n".join(lines).rstrip() + "\n"
+
+
+def render_evaluation_profile_summary(
+    manifest: dict[str, object], rows: list[dict[str, str]]
+) -> str:
+    distributions = term_distributions(rows)
+    total = distributions["evaluation"][0]
+    unit = manifest["tick_unit"]
+    lines = [
+        f"# Evaluation profile: {manifest['label']}",
+        "",
+        "## Metadata",
+        f"- Run directory: `{manifest['run_dir']}`",
+        f"- Git revision: `{manifest['git_revision']}`",
+        f"- Git dirty: `{manifest['git_dirty']}`",
+        f"- Benchmark: `{manifest['benchmark_path']}`",
+        "- Build: `{}` / `{}` / `{}`".format(
+            manifest["build_preset"], manifest["build_mode"], manifest["compiler"]
+        ),
+        "- Corpus: `{}` positions, version `{}`".format(
+            manifest["corpus_size"], manifest["corpus_version"]
+        ),
+        f"- Workload: `{manifest['warmup_repetitions']}` warmup repetitions; "
+        f"`{manifest['repetitions']}` repetitions × `{manifest['samples']}` samples",
+        f"- Tick unit: `{unit}`",
+        "",
+        "## Median cost per evaluation (min–max)",
+        f"| Term | {unit}/evaluation | Share |",
+        "|---|---:|---:|",
+    ]
+    for term in EVALUATION_PROFILE_TERMS:
+        distribution = distributions[term]
+        share = f"{distribution[0] / total * 100.0:.1f}%" if total else ""
+        lines.append(f"| {term} | {format_distribution(distribution)} | {share} |")
+    return "\n".join(lines) + "\n"
+
+
+def render_evaluation_profile_compare(
+    old_dir: Path,
+    new_dir: Path,
+    old_manifest: dict[str, object],
+    new_manifest: dict[str, object],
+) -> str:
+    _, old_rows = read_tsv(old_dir / "results.tsv", EVALUATION_PROFILE_COLUMNS)
+    _, new_rows = read_tsv(new_dir / "results.tsv", EVALUATION_PROFILE_COLUMNS)
+    validate_profile_rows(old_rows)
+    validate_profile_rows(new_rows)
+
+    old_terms = term_distributions(old_rows)
+    new_terms = term_distributions(new_rows)
+    unit = old_manifest["tick_unit"]
+    lines = [
+        f"# Evaluation profile comparison: {old_manifest.get('label')} vs "
+        f"{new_manifest.get('label')}",
+        "",
+        "## Runs",
+        f"- Baseline: `{old_dir}`",
+        f"- Candidate: `{new_dir}`",
+        f"- Tick unit: `{unit}`",
+        "",
+        "## Median deltas (lower is better)",
+        f"| Term | Baseline {unit}/evaluation [min–max] | Candidate [min–max] | Delta |",
+        "|---|---:|---:|---:|",
+    ]
+    for term in EVALUATION_PROFILE_TERMS:
+        lines.append(
+            "| {} | {} | {} | {} |".format(
+                term,
+                format_distribution(old_terms[term]),
+                format_distribution(new_terms[term]),
+                percent_delta(old_terms[term][0], new_terms[term][0]),
+            )
+        )
+    return "\n".join(lines).rstrip() + "\n"
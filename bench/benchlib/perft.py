@@ -35,7 +35,9 @@ PERFT_COLUMNS = [
 def add_perft_parser(subparsers: argparse._SubParsersAction[argparse.ArgumentParser]) -> None:
     parser = subparsers.add_parser("perft", help="run recursive move generation benchmark")
     add_common_run_args(parser)
-    parser.add_argument("--profile", choices=["smoke", "standard"], default="smoke")
+    parser.add_argument("--profile", choices=["smoke", "standard", "deep"], default="smoke")
+    parser.add_argument("--threads", type=int, default=1, help="threads sharing the root moves")
+    parser.add_argument("--hash", type=int, default=0, help="perft table size in MiB; 0 disables it")
 
 
 def command_run_perft(args: argparse.Namespace) -> int:
@@ -44,7 +46,17 @@ def command_run_perft(args: argparse.Namespace) -> int:
     if not benchmark.exists():
         raise FileNotFoundError(f"benchmark binary not found: {benchmark}")
 
-    command = [str(benchmark), "--profile", args.profile, "--format", "tsv"]
+    command = [
+        str(benchmark),
+        "--profile",
+        args.profile,
+        "--threads",
+        str(args.threads),
+        "--hash",
+        str(args.hash),
+        "--format",
+        "tsv",
+    ]
     stdout, stderr = run_capture(command, cwd=args.repo)
     if not stdout.strip():
         raise RuntimeError("perft benchmark produced no TSV output")
@@ -60,6 +72,8 @@ def command_run_perft(args: argparse.Namespace) -> int:
             "benchmark_path": str(benchmark.resolve()),
             "command": command,
             "profile": args.profile,
+            "threads": args.threads,
+            "hash_mb": args.hash,
         }
     )
     write_tsv(run_dir / "results.tsv", rows, PERFT_COLUMNS)
@@ -92,6 +106,7 @@ def render_perft_summary(manifest: dict[str, object], rows: list[dict[str, str]]
         f"- Git dirty: `{manifest['git_dirty']}`",
         f"- Build preset: `{manifest['build_preset']}`",
         f"- Profile: `{manifest['profile']}`",
+        f"- Threads: `{manifest['threads']}`; hash: `{manifest['hash_mb']} MiB`",
         "",
         "## Results",
         "| Case | Depth | Nodes | Time ms | Nodes/sec |",
@@ -1,13 +1,9 @@
 #include <string_view>
 
-#include "core/attacks.hpp"
-
 #include "evaluation.hpp"
 #include "perft.hpp"
 
 int main(int argc, char* argv[]) {
-    attacks::init();
-
     if (argc > 1 && std::string_view(argv[1]) == "eval")
         return bench::run_evaluation(argc - 1, argv + 1);
     if (argc > 1 && std::string_view(argv[1]) == "perft")
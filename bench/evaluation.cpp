@@ -1,5 +1,6 @@
 #include "evaluation.hpp"
 
+#include <algorithm>
 #include <array>
 #include <charconv>
 #include <chrono>
@@ -18,6 +19,8 @@
 #include <utility>
 
 #include "eval/evaluation.hpp"
+#include "eval/material_table.hpp"
+#include "eval/profile.hpp"
 
 namespace bench {
 namespace {
@@ -29,6 +32,8 @@ constexpr std::string_view corpus_header     = "corpus_version\tid\tcategory\tfe
 constexpr std::string_view corpus_version    = "1";
 constexpr std::string_view result_format     = "evaluation_snapshot_v1";
 constexpr std::string_view throughput_format = "evaluation_throughput_v1";
+constexpr std::string_view swing_format      = "evaluation_swing_v1";
+constexpr std::string_view profile_format    = "evaluation_profile_v1";
 
 constexpr std::uint64_t default_warmup_repetitions = 50'000;
 constexpr std::uint64_t default_repetitions        = 100'000;
@@ -50,6 +55,9 @@ constexpr std::array<std::pair<std::string_view, eval::Term>, 10> terms = {{
     {"threats", eval::Term::Threats},
 }};
 
+// Terms evaluate_lazy leaves out; material and squares are its estimate.
+constexpr std::size_t first_positional_term = 2;
+
 enum SnapshotColumn : std::size_t {
     ResultFormat,
     CorpusVersion,
@@ -99,6 +107,8 @@ struct EvaluatedPosition {
 struct EvaluationOptions {
     fs::path      corpus = default_corpus_path();
     bool          throughput{false};
+    bool          swing{false};
+    bool          profile{false};
     std::uint64_t warmup_repetitions{default_warmup_repetitions};
     std::uint64_t repetitions{default_repetitions};
     std::uint64_t samples{default_samples};
@@ -109,6 +119,12 @@ struct ThroughputRow {
     std::uint64_t total_ns{0};
 };
 
+// One sample's ticks per term, then whole evaluations and the part no term dispatch covers.
+struct ProfileSample {
+    eval::TermProfile terms;
+    std::uint64_t     evaluation_ticks{0};
+};
+
 [[noreturn]] void fail(std::size_t line, std::string_view message) {
     throw std::runtime_error("invalid evaluation corpus at line " + std::to_string(line) + ": "
                              + std::string(message));
@@ -172,10 +188,10 @@ std::string snapshot_tsv(const std::vector<EvaluatedPosition>& results) {
         summary[Category]        = position.category;
         summary[Fen]             = position.board.to_fen();
         summary[SideToMove]      = position.board.side_to_move() == WHITE ? "w" : "b";
-        summary[UnscaledMg]      = std::to_string(trace.unscaled_score().mg);
-        summary[UnscaledEg]      = std::to_string(trace.unscaled_score().eg);
-        summary[ScaledMg]        = std::to_string(trace.scaled_score().mg);
-        summary[ScaledEg]        = std::to_string(trace.scaled_score().eg);
+        summary[UnscaledMg]      = std::to_string(trace.unscaled_score().mg());
+        summary[UnscaledEg]      = std::to_string(trace.unscaled_score().eg());
+        summary[ScaledMg]        = std::to_string(trace.scaled_score().mg());
+        summary[ScaledEg]        = std::to_string(trace.scaled_score().eg());
         summary[TaperedValue]    = std::to_string(trace.tapered_value());
         summary[SideToMoveValue] = std::to_string(trace.side_to_move_value());
         summary[Value]           = std::to_string(trace.value());
@@ -192,12 +208,12 @@ std::string snapshot_tsv(const std::vector<EvaluatedPosition>& results) {
             term_row[RecordType]    = "term";
             term_row[Term]          = name;
             term_row[PerColor]      = score.per_color ? "1" : "0";
-            term_row[WhiteMg]       = std::to_string(score.white.mg);
-            term_row[WhiteEg]       = std::to_string(score.white.eg);
-            term_row[BlackMg]       = std::to_string(score.black.mg);
-            term_row[BlackEg]       = std::to_string(score.black.eg);
-            term_row[TotalMg]       = std::to_string(total.mg);
-            term_row[TotalEg]       = std::to_string(total.eg);
+            term_row[WhiteMg]       = std::to_string(score.white.mg());
+            term_row[WhiteEg]       = std::to_string(score.white.eg());
+            term_row[BlackMg]       = std::to_string(score.black.mg());
+            term_row[BlackEg]       = std::to_string(score.black.eg());
+            term_row[TotalMg]       = std::to_string(total.mg());
+            term_row[TotalEg]       = std::to_string(total.eg());
             emit_row(output, term_row);
         }
     }
@@ -299,11 +315,144 @@ std::string throughput_tsv(const std::vector<ThroughputRow>&      rows,
     return output.str();
 }
 
+std::vector<ProfileSample> measure_profile(const std::vector<EvaluationPosition>& positions,
+                                           const EvaluationOptions&               options) {
+    if (!eval::profiling)
+        throw std::runtime_error("profile needs a build with -DLATRUNCULI_EVAL_PROFILE=ON");
+
+    evaluate_repeated(positions, options.warmup_repetitions);
+
+    std::uint64_t              expected_checksum = 0;
+    std::vector<ProfileSample> samples;
+    samples.reserve(static_cast<std::size_t>(options.samples));
+
+    for (std::uint64_t sample = 1; sample <= options.samples; ++sample) {
+        eval::term_profile() = {};
+        const std::uint64_t start    = eval::profile_ticks();
+        const std::uint64_t checksum = evaluate_repeated(positions, options.repetitions);
+        const std::uint64_t end      = eval::profile_ticks();
+
+        if (sample == 1)
+            expected_checksum = checksum;
+        else if (checksum != expected_checksum)
+            throw std::runtime_error("evaluation sample checksum mismatch");
+
+        samples.push_back({.terms = eval::term_profile(), .evaluation_ticks = end - start});
+    }
+    return samples;
+}
+
+void emit_profile_row(std::ostream&    output,
+                      std::string_view sample_columns,
+                      std::string_view term,
+                      std::uint64_t    calls,
+                      std::uint64_t    ticks,
+                      std::uint64_t    evaluations) {
+    const double ticks_per_call =
+        calls ? static_cast<double>(ticks) / static_cast<double>(calls) : 0.0;
+    output << sample_columns << '\t' << term << '\t' << calls << '\t' << ticks << '\t'
+           << std::fixed << std::setprecision(3) << ticks_per_call << '\t'
+           << static_cast<double>(ticks) / static_cast<double>(evaluations) << '\n';
+}
+
+// Long-form rows per sample: one per term, "other" for the evaluator's setup, scaling and the
+// benchmark loop, and "evaluation" for the whole call. Ticks per evaluation compare across
+// runs; ticks per call divide by the term's dispatches, two per evaluation for most terms.
+std::string profile_tsv(const std::vector<ProfileSample>&      samples,
+                        const std::vector<EvaluationPosition>& positions,
+                        const EvaluationOptions&               options) {
+    std::ostringstream output;
+    const auto evaluations = static_cast<std::uint64_t>(positions.size()) * options.repetitions;
+    output << "result_format\tcorpus_version\tcompiler\tbuild_mode\ttick_unit\tsample\t"
+              "samples\tcorpus_size\twarmup_repetitions\trepetitions\tevaluations\tterm\t"
+              "calls\tticks\tticks_per_call\tticks_per_evaluation\n";
+
+    for (std::size_t index = 0; index < samples.size(); ++index) {
+        const ProfileSample& sample = samples[index];
+        std::ostringstream   columns;
+        columns << profile_format << '\t' << corpus_version << '\t' << compiler_name() << '\t'
+                << build_mode() << '\t' << eval::profile_tick_unit << '\t' << index + 1 << '\t'
+                << options.samples << '\t' << positions.size() << '\t'
+                << options.warmup_repetitions << '\t' << options.repetitions << '\t'
+                << evaluations;
+        const std::string sample_columns = columns.str();
+
+        std::uint64_t term_ticks = 0;
+        for (const auto& [name, term] : terms) {
+            const auto slot = std::to_underlying(term);
+            emit_profile_row(output,
+                             sample_columns,
+                             name,
+                             sample.terms.calls[slot],
+                             sample.terms.ticks[slot],
+                             evaluations);
+            term_ticks += sample.terms.ticks[slot];
+        }
+        const std::uint64_t total_ticks = sample.evaluation_ticks;
+        const std::uint64_t other_ticks = total_ticks > term_ticks ? total_ticks - term_ticks : 0;
+        emit_profile_row(output, sample_columns, "other", evaluations, other_ticks, evaluations);
+        emit_profile_row(
+            output, sample_columns, "evaluation", evaluations, total_ticks, evaluations);
+    }
+    return output.str();
+}
+
+struct SwingRow {
+    std::string_view name;
+    EvalValue        max_swing{0};
+    std::string      position_id;
+};
+
+void record_swing(SwingRow& row, EvalValue swing, const EvaluationPosition& position) {
+    if (swing > row.max_swing || row.position_id.empty()) {
+        row.max_swing   = swing;
+        row.position_id = position.id;
+    }
+}
+
+// Largest contribution of each term evaluate_lazy skips, bounded by its larger phase score,
+// and the largest gap between the full value and the material and PSQT estimate. Positions
+// with known endgames or scaling functions are skipped, as evaluate_lazy never shortcuts them.
+std::string swing_tsv(const std::vector<EvaluationPosition>& positions) {
+    std::vector<SwingRow> rows;
+    for (std::size_t index = first_positional_term; index < terms.size(); ++index)
+        rows.push_back({.name = terms[index].first});
+    rows.push_back({.name = "positional"});
+
+    std::size_t measured = 0;
+    for (const EvaluationPosition& position : positions) {
+        const eval::MaterialEntry material = eval::MaterialTable::analyse(position.board);
+        if (material.evaluation || material.scaling)
+            continue;
+
+        ++measured;
+        const eval::Trace trace = eval::evaluate_trace(position.board);
+        for (std::size_t index = first_positional_term; index < terms.size(); ++index) {
+            const eval::TaperedScore total = trace.term(terms[index].second).total();
+            record_swing(rows[index - first_positional_term],
+                         std::max(std::abs(total.mg()), std::abs(total.eg())),
+                         position);
+        }
+        record_swing(
+            rows.back(), std::abs(trace.value() - eval::evaluate_base(position.board)), position);
+    }
+
+    std::ostringstream output;
+    output << "result_format\tcorpus_version\tterm\tpositions\tmax_swing\tposition_id\n";
+    for (const SwingRow& row : rows)
+        output << swing_format << '\t' << corpus_version << '\t' << row.name << '\t' << measured
+               << '\t' << row.max_swing << '\t' << row.position_id << '\n';
+    return output.str();
+}
+
 void print_usage(const char* argv0) {
     std::cerr << "Handcrafted-evaluation snapshots and throughput measurement.\n";
     std::cerr << "Usage: " << argv0 << " [--corpus PATH]\n";
     std::cerr << "       " << argv0
               << " throughput [--corpus PATH] [--warmup N] [--repetitions N] [--samples N]\n";
+    std::cerr << "       " << argv0 << " swing [--corpus PATH]\n";
+    std::cerr << "       " << argv0
+              << " profile [--corpus PATH] [--warmup N] [--repetitions N] [--samples N]\n";
 }
 
 std::uint64_t parse_count(std::string_view text, std::string_view option) {
@@ -321,7 +470,14 @@ EvaluationOptions parse_args(int argc, char* argv[]) {
     if (index < argc && std::string_view(argv[index]) == "throughput") {
         options.throughput = true;
         ++index;
+    } else if (index < argc && std::string_view(argv[index]) == "swing") {
+        options.swing = true;
+        ++index;
+    } else if (index < argc && std::string_view(argv[index]) == "profile") {
+        options.profile = true;
+        ++index;
     }
+    const bool timed = options.throughput || options.profile;
 
     for (; index < argc; ++index) {
         const std::string_view argument = argv[index];
@@ -335,19 +491,19 @@ EvaluationOptions parse_args(int argc, char* argv[]) {
             options.corpus = argv[index];
             continue;
         }
-        if (options.throughput && argument == "--warmup") {
+        if (timed && argument == "--warmup") {
             if (++index >= argc)
                 throw std::runtime_error("missing value for --warmup");
             options.warmup_repetitions = parse_count(argv[index], "--warmup");
             continue;
         }
-        if (options.throughput && argument == "--repetitions") {
+        if (timed && argument == "--repetitions") {
             if (++index >= argc)
                 throw std::runtime_error("missing value for --repetitions");
             options.repetitions = parse_count(argv[index], "--repetitions");
             continue;
         }
-        if (options.throughput && argument == "--samples") {
+        if (timed && argument == "--samples") {
             if (++index >= argc)
                 throw std::runtime_error("missing value for --samples");
             options.samples = parse_count(argv[index], "--samples");
@@ -445,6 +601,15 @@ int run_evaluation(int argc, char* argv[]) {
             std::cout << throughput_tsv(rows, positions, options);
             return 0;
         }
+        if (options.swing) {
+            std::cout << swing_tsv(positions);
+            return 0;
+        }
+        if (options.profile) {
+            const auto samples = measure_profile(positions, options);
+            std::cout << profile_tsv(samples, positions, options);
+            return 0;
+        }
 
         std::vector<EvaluatedPosition> results;
         results.reserve(positions.size());
@@ -12,7 +12,7 @@
 #include <vector>
 
 #include "board/board.hpp"
-#include "movegen/generator.hpp"
+#include "movegen/perft.hpp"
 
 namespace bench {
 namespace {
@@ -29,20 +29,19 @@ constexpr const char* POS6 =
     "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10";
 
 enum class OutputFormat { Text, Tsv };
-enum class Profile { Smoke, Standard };
+enum class Profile { Smoke, Standard, Deep };
 
 struct Options {
-    OutputFormat format{OutputFormat::Text};
-    Profile      profile{Profile::Smoke};
+    OutputFormat          format{OutputFormat::Text};
+    Profile               profile{Profile::Smoke};
+    movegen::PerftOptions perft{};
 };
 
 struct PerftCase {
     std::string_view id;
     std::string_view fen;
-    int              smoke_depth;
-    NodeCount        smoke_nodes;
-    int              standard_depth;
-    NodeCount        standard_nodes;
+    int              depth;
+    NodeCount        nodes;
 };
 
 struct PerftRow {
@@ -64,56 +63,56 @@ std::uint64_t measure_ns(Fn&& fn) {
         std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
 }
 
-NodeCount perft_nodes(Board& board, int depth) {
-    if (depth == 0)
-        return 1;
-
-    NodeCount nodes    = 0;
-    auto      movelist = movegen::generate_pseudo_legal(board);
-
-    for (auto& move : movelist) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
-
-        board.make(move);
-        nodes += perft_nodes(board, depth - 1);
-        board.unmake();
-    }
-
-    return nodes;
-}
-
 std::string to_string(Profile profile) {
-    return profile == Profile::Smoke ? "smoke" : "standard";
+    switch (profile) {
+    case Profile::Smoke:    return "smoke";
+    case Profile::Standard: return "standard";
+    case Profile::Deep:     return "deep";
+    }
+    return "unknown";
 }
 
 std::vector<PerftCase> perft_cases(Profile profile) {
-    std::vector<PerftCase> cases = {
-        {"startpos", START_FEN, 4, 197281, 4, 197281},
-        {"pos3", POS3, 4, 43238, 4, 43238},
-        {"pos5", POS5, 3, 62379, 4, 2103487},
-    };
-
-    if (profile == Profile::Standard) {
-        cases.push_back({"pos2", POS2, 3, 97862, 4, 4085603});
-        cases.push_back({"pos4w", POS4W, 3, 9467, 4, 422333});
-        cases.push_back({"pos4b", POS4B, 3, 9467, 4, 422333});
-        cases.push_back({"pos6", POS6, 3, 89890, 4, 3894594});
+    switch (profile) {
+    case Profile::Smoke:
+        return {
+            {"startpos", START_FEN, 4, 197281},
+            {"pos3", POS3, 4, 43238},
+            {"pos5", POS5, 3, 62379},
+        };
+    case Profile::Standard:
+        return {
+            {"startpos", START_FEN, 4, 197281},
+            {"pos3", POS3, 4, 43238},
+            {"pos5", POS5, 4, 2103487},
+            {"pos2", POS2, 4, 4085603},
+            {"pos4w", POS4W, 4, 422333},
+            {"pos4b", POS4B, 4, 422333},
+            {"pos6", POS6, 4, 3894594},
+        };
+    case Profile::Deep:
+        // Intended for --threads and --hash; single-threaded without a table it runs minutes.
+        return {
+            {"startpos", START_FEN, 6, 119060324},
+            {"pos3", POS3, 7, 178633661},
+            {"pos5", POS5, 5, 89941194},
+            {"pos2", POS2, 6, 8031647685},
+            {"pos4w", POS4W, 5, 15833292},
+            {"pos6", POS6, 5, 164075551},
+        };
     }
-
-    return cases;
+    return {};
 }
 
-PerftRow run_perft_case(const PerftCase& perft_case, Profile profile) {
-    Board      board(perft_case.fen);
-    const auto initial_key = board.key();
-    const int  depth =
-        profile == Profile::Smoke ? perft_case.smoke_depth : perft_case.standard_depth;
-    const NodeCount expected =
-        profile == Profile::Smoke ? perft_case.smoke_nodes : perft_case.standard_nodes;
-    NodeCount nodes = 0;
+PerftRow run_perft_case(const PerftCase& perft_case, const Options& options) {
+    Board           board(perft_case.fen);
+    const auto      initial_key = board.key();
+    const int       depth       = perft_case.depth;
+    const NodeCount expected    = perft_case.nodes;
+    NodeCount       nodes       = 0;
 
-    const std::uint64_t total_ns = measure_ns([&] { nodes = perft_nodes(board, depth); });
+    const std::uint64_t total_ns =
+        measure_ns([&] { nodes = movegen::perft(board, depth, options.perft); });
 
     if (nodes != expected) {
         std::ostringstream message;
@@ -127,7 +126,7 @@ PerftRow run_perft_case(const PerftCase& perft_case, Profile profile) {
     const double seconds = static_cast<double>(total_ns) / 1'000'000'000.0;
     return {
         .case_id        = std::string(perft_case.id),
-        .profile        = to_string(profile),
+        .profile        = to_string(options.profile),
         .depth          = depth,
         .nodes          = nodes,
         .expected_nodes = expected,
@@ -160,6 +159,8 @@ Profile parse_profile(const std::string& value) {
         return Profile::Smoke;
     if (value == "standard")
         return Profile::Standard;
+    if (value == "deep")
+        return Profile::Deep;
     throw std::runtime_error("unknown profile: " + value);
 }
 
@@ -171,9 +172,24 @@ OutputFormat parse_format(const std::string& value) {
     throw std::runtime_error("unknown format: " + value);
 }
 
+int parse_count(const std::string& value, std::string_view flag) {
+    std::size_t parsed = 0;
+    int         count  = 0;
+    try {
+        count = std::stoi(value, &parsed);
+    } catch (const std::exception&) {
+        parsed = 0;
+    }
+    if (parsed != value.size() || count < 0)
+        throw std::runtime_error("invalid value for " + std::string(flag) + ": " + value);
+    return count;
+}
+
 void print_usage(const char* argv0) {
     std::cerr << "Perft benchmark for recursive move generation validation.\n";
-    std::cerr << "Usage: " << argv0 << " [--profile smoke|standard] [--format text|tsv]\n";
+    std::cerr << "Usage: " << argv0
+              << " [--profile smoke|standard|deep] [--threads N] [--hash MB]"
+                 " [--format text|tsv]\n";
 }
 
 Options parse_args(int argc, char* argv[]) {
@@ -194,6 +210,20 @@ Options parse_args(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--threads") {
+            if (++i >= argc)
+                throw std::runtime_error("missing value for --threads");
+            options.perft.threads = parse_count(argv[i], "--threads");
+            continue;
+        }
+
+        if (arg == "--hash") {
+            if (++i >= argc)
+                throw std::runtime_error("missing value for --hash");
+            options.perft.hash_mb = parse_count(argv[i], "--hash");
+            continue;
+        }
+
         if (arg == "--format") {
             if (++i >= argc)
                 throw std::runtime_error("missing value for --format");
@@ -214,7 +244,7 @@ int run_perft(int argc, char* argv[]) {
         const Options         options = parse_args(argc, argv);
         std::vector<PerftRow> rows;
         for (const auto& perft_case : perft_cases(options.profile))
-            rows.push_back(run_perft_case(perft_case, options.profile));
+            rows.push_back(run_perft_case(perft_case, options));
 
         if (options.format == OutputFormat::Tsv)
             emit_tsv(rows);
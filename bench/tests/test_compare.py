@@ -22,6 +22,8 @@ class ComparisonContractTest(unittest.TestCase):
             "result_format": "perft",
             "suite": "perft",
             "profile": "smoke",
+            "threads": 1,
+            "hash_mb": 0,
         }
         cases = {
             "missing version": (
@@ -44,6 +46,11 @@ class ComparisonContractTest(unittest.TestCase):
                 {**manifest, "profile": "standard"},
                 "runs with different profile",
             ),
+            "different perft threads": (
+                manifest,
+                {**manifest, "threads": 2},
+                "runs with different threads",
+            ),
             "different evaluation corpora": (
                 {
                     **manifest,
@@ -9,9 +9,13 @@ from pathlib import Path
 
 from bench.benchlib.common import FORMAT_VERSION
 from bench.benchlib.evaluation import (
+    EVALUATION_PROFILE_COLUMNS,
+    EVALUATION_PROFILE_FORMAT,
+    EVALUATION_PROFILE_TERMS,
     EVALUATION_THROUGHPUT_COLUMNS,
     EVALUATION_THROUGHPUT_FORMAT,
     parse_evaluation_rows,
+    parse_profile_rows,
 )
 
 
@@ -49,6 +53,39 @@ def evaluation_output(*, candidate: bool = False) -> str:
     return "\n".join((header, *rows)) + "\n"
 
 
+def profile_output(*, candidate: bool = False) -> str:
+    header = "\t".join(EVALUATION_PROFILE_COLUMNS)
+    scale = 9 if candidate else 10
+    rows = []
+    for sample in (1, 2):
+        for index, term in enumerate(EVALUATION_PROFILE_TERMS):
+            calls = 48 if term in ("other", "evaluation") else 96
+            ticks = scale * (48 * 20 if term == "evaluation" else 48 * (index + 1) // 10 + 1)
+            rows.append(
+                "\t".join(
+                    (
+                        EVALUATION_PROFILE_FORMAT,
+                        "1",
+                        "GCC test",
+                        "release",
+                        "tsc_cycles",
+                        str(sample),
+                        "2",
+                        "24",
+                        "1",
+                        "2",
+                        "48",
+                        term,
+                        str(calls),
+                        str(ticks),
+                        f"{ticks / calls:.3f}",
+                        f"{ticks / 48:.3f}",
+                    )
+                )
+            )
+    return "\n".join((header, *rows)) + "\n"
+
+
 class EvaluationBenchmarkTest(unittest.TestCase):
     def test_parser_validates_schema_and_sample_consistency(self) -> None:
         output = evaluation_output()
@@ -109,6 +146,64 @@ class EvaluationBenchmarkTest(unittest.TestCase):
             self.assertIn("Nanoseconds/evaluation", report)
             self.assertIn("Checksums: `3992` / `3992` (match)", report)
 
+    def test_profile_parser_validates_term_sequence(self) -> None:
+        output = profile_output()
+        self.assertEqual(len(parse_profile_rows(output)), 2 * len(EVALUATION_PROFILE_TERMS))
+
+        cases = {
+            "header": output.replace("tick_unit", "unit", 1),
+            "term sequence": output.replace("\tknights\t", "\tbishops\t", 1),
+            "tick unit": output.replace("\ttsc_cycles\t", "\tns\t", 1),
+            "truncated sample": output.rsplit("\n", 2)[0] + "\n",
+            "evaluation count": output.replace("\t48\t", "\t47\t", 1),
+        }
+        for name, invalid in cases.items():
+            with self.subTest(name=name), self.assertRaises(RuntimeError):
+                parse_profile_rows(invalid)
+
+    def test_compare_dispatches_and_renders_profile_terms(self) -> None:
+        with tempfile.TemporaryDirectory() as directory:
+            root = Path(directory)
+            baseline = root / "baseline"
+            candidate = root / "candidate"
+            baseline.mkdir()
+            candidate.mkdir()
+
+            manifest = {
+                "format_version": FORMAT_VERSION,
+                "result_format": EVALUATION_PROFILE_FORMAT,
+                "suite": "eval-profile",
+                "label": "baseline",
+                "corpus_sha256": "abc",
+                "corpus_version": "1",
+                "corpus_size": 24,
+                "warmup_repetitions": 1,
+                "repetitions": 2,
+                "samples": 2,
+                "tick_unit": "tsc_cycles",
+            }
+            (baseline / "manifest.json").write_text(json.dumps(manifest), encoding="utf-8")
+            (candidate / "manifest.json").write_text(
+                json.dumps({**manifest, "label": "candidate"}), encoding="utf-8"
+            )
+            (baseline / "results.tsv").write_text(profile_output(), encoding="utf-8")
+            (candidate / "results.tsv").write_text(
+                profile_output(candidate=True), encoding="utf-8"
+            )
+
+            result = subprocess.run(
+                [sys.executable, str(BENCH_SCRIPT), "compare", str(baseline), str(candidate)],
+                cwd=REPO_ROOT,
+                text=True,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.PIPE,
+            )
+
+            self.assertEqual(result.returncode, 0, result.stderr)
+            report = Path(result.stdout.strip()).read_text(encoding="utf-8")
+            self.assertIn("Evaluation profile comparison: baseline vs candidate", report)
+            self.assertIn("| evaluation | 200 [200–200] | 180 [180–180] | -10.0% |", report)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -3,6 +3,8 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -21,12 +23,19 @@
 /**
  * Mutable chess position with owned, reversible history from the loaded
  * position. Moves and null moves append history entries and are unmade in LIFO
- * order.
+ * order. The history lives in a fixed-capacity stack; a full stack drops its
+ * oldest entries beyond the repetition window and a search line.
  */
 class Board {
 public:
     static constexpr char start_fen[] = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
 
+    // History entries the repetition check can reach: the 8-bit halfmove clock counts at most
+    // 255 reversible plies before the current position.
+    static constexpr std::size_t repetition_window = 256;
+    // Ply-stack capacity: a full repetition window plus a search line made from it.
+    static constexpr std::size_t ply_capacity = repetition_window + engine::max_search_ply + 1;
+
     // Representation lifecycle and key diagnostics (board_representation.cpp)
 
     explicit Board(std::string_view fen = start_fen);
@@ -35,8 +44,14 @@ public:
     Board(Board&&)            = delete;
     Board& operator=(Board&&) = delete;
 
+    // Copies source's position with only the history its draw detection can still reach, so
+    // the cost does not grow with game length. Earlier moves cannot be unmade from the copy.
+    void assign_search_root(const Board& source) noexcept;
+
     void            clear_position() noexcept;
     PositionKey     recompute_key() const noexcept;
+    PositionKey     recompute_pawn_key() const noexcept;
+    PositionKey     recompute_material_key() const noexcept;
     eval::BaseTerms recompute_base_terms() const noexcept;
 
     // Position and state queries
@@ -62,6 +77,8 @@ public:
 
     Color          side_to_move() const noexcept { return turn; }
     PositionKey    key() const noexcept { return ply_state().zkey; }
+    PositionKey    pawn_key() const noexcept { return ply_state().pawn_key; }
+    PositionKey    material_key() const noexcept { return ply_state().material_key; }
     CastlingRights castling_rights() const noexcept { return ply_state().castling_rights; }
 
     Square enpassant_target() const noexcept { return ply_state().enpassant_target; }
@@ -71,10 +88,14 @@ public:
     int          fullmove_number() const noexcept { return (absolute_ply / 2) + 1; }
 
     Move previous_move() const noexcept { return ply_state().previous_move; }
-    bool can_unmake() const noexcept { return ply_states.size() > 1; }
+    bool can_unmake() const noexcept { return ply_count > 1; }
+
+    // Retained history from the loaded position; back() is the current position.
+    std::span<const PlyState> history() const noexcept { return {ply_stack.get(), ply_count}; }
 
     Bitboard checkers() const noexcept { return ply_state().checkers; }
     Bitboard blockers(Color king_color) const noexcept { return ply_state().blockers[king_color]; }
+    Bitboard check_squares(PieceType piece_type) const noexcept;
     bool     is_check() const noexcept { return checkers(); }
     bool     is_double_check() const noexcept { return bb::is_many(checkers()); }
 
@@ -109,6 +130,7 @@ public:
     bool is_legal_move(Move move) const noexcept;
     bool gives_check(Move move) const noexcept;
     bool is_draw(int ply_from_search_root = 0) const noexcept;
+    bool has_game_cycle(int ply_from_search_root = 0) const noexcept;
 
     // Move application and reversal (board_move.cpp)
 
@@ -117,9 +139,14 @@ public:
     void make_null();
     void unmake_null();
 
+    PositionKey key_after(Move move) const noexcept;
+
     // Static exchange evaluation (board_see.cpp)
 
     EvalValue see(Move move) const noexcept;
+    // Whether see(move) >= threshold, stopping as soon as the exchange settles that question.
+    // Also accepts quiet and castling moves, which start the exchange with nothing captured.
+    bool see_ge(Move move, EvalValue threshold) const noexcept;
 
 private:
     // Ply-state storage
@@ -128,6 +155,8 @@ private:
     const PlyState& ply_state() const noexcept;
     PlyState&       push_ply_state(Move move);
     void            pop_ply_state() noexcept;
+    void            drop_unreachable_history() noexcept;
+    void            copy_position(const Board& source, std::size_t history_plies) noexcept;
 
     // Incremental representation mutation
 
@@ -137,6 +166,16 @@ private:
     void remove_piece(Square square, Color color, PieceType piece_type) noexcept;
     template <bool apply_hash>
     void move_piece(Square from, Square to, Color color, PieceType piece_type) noexcept;
+    void record_dirty_piece(Piece piece, Square from, Square to) noexcept;
+    void fill_check_squares() const noexcept;
+
+    // Static exchange helpers
+
+    Bitboard least_valuable_attacker(Square     to,
+                                     Color      side,
+                                     Bitboard   attackers,
+                                     Bitboard   occupancy,
+                                     PieceType& attacker_type) const noexcept;
 
     // Position storage
 
@@ -154,51 +193,69 @@ private:
     // HCE-specific incremental material and piece-square terms.
     eval::BaseTerms cached_base_terms;
 
-    // Reversible history from the loaded root; active_state points to ply_states.back().
-    std::vector<PlyState> ply_states;
-    PlyState*             active_state = nullptr;
+    // Reversible history from the loaded root in ply_stack[0, ply_count); active_state points to
+    // the last entry.
+    std::unique_ptr<PlyState[]> ply_stack    = std::make_unique<PlyState[]>(ply_capacity);
+    std::size_t                 ply_count    = 0;
+    PlyState*                   active_state = nullptr;
 };
 
 // Inline ply-state storage definitions
 
 inline PlyState& Board::ply_state() noexcept {
-    assert(!ply_states.empty() && active_state == &ply_states.back());
+    assert(ply_count > 0 && active_state == &ply_stack[ply_count - 1]);
     return *active_state;
 }
 
 inline const PlyState& Board::ply_state() const noexcept {
-    assert(!ply_states.empty() && active_state == &ply_states.back());
+    assert(ply_count > 0 && active_state == &ply_stack[ply_count - 1]);
     return *active_state;
 }
 
 inline PlyState& Board::push_ply_state(Move move) {
-    assert(!ply_states.empty());
-
-    const std::size_t previous_index = ply_states.size() - 1;
-    PlyState&         state          = ply_states.emplace_back();
-    active_state                     = &state;
-
-    const PlyState& previous = ply_states[previous_index];
-    state.zkey               = previous.zkey;
-    state.castling_rights    = previous.castling_rights;
-    state.halfmove_clock     = previous.halfmove_clock + 1;
-    state.previous_move      = move;
+    assert(ply_count > 0);
+    if (ply_count == ply_capacity) [[unlikely]]
+        drop_unreachable_history();
+
+    const PlyState& previous = ply_stack[ply_count - 1];
+    PlyState&       state    = ply_stack[ply_count++];
+    active_state             = &state;
+
+    state.zkey            = previous.zkey;
+    state.pawn_key        = previous.pawn_key;
+    state.material_key    = previous.material_key;
+    state.castling_rights = previous.castling_rights;
+    state.halfmove_clock  = previous.halfmove_clock + 1;
+    state.previous_move   = move;
+
+    // The slot may hold an older ply; reset what make() does not always overwrite. The
+    // tactical cache is always refreshed.
+    state.enpassant_target       = INVALID;
+    state.legal_enpassant_target = INVALID;
+    state.captured_piece_type    = NO_PIECETYPE;
+    state.dirty_count            = 0;
     return state;
 }
 
 inline void Board::pop_ply_state() noexcept {
-    assert(ply_states.size() > 1);
-    ply_states.pop_back();
-    active_state = &ply_states.back();
+    assert(ply_count > 1);
+    --ply_count;
+    active_state = &ply_stack[ply_count - 1];
 }
 
 // Inline query definitions
 
 inline EvalValue Board::non_pawn_material(Color color) const noexcept {
-    return ((count(color, KNIGHT) * eval::piece(KNIGHT).mg)
-            + (count(color, BISHOP) * eval::piece(BISHOP).mg)
-            + (count(color, ROOK) * eval::piece(ROOK).mg)
-            + (count(color, QUEEN) * eval::piece(QUEEN).mg));
+    return ((count(color, KNIGHT) * eval::piece(KNIGHT).mg())
+            + (count(color, BISHOP) * eval::piece(BISHOP).mg())
+            + (count(color, ROOK) * eval::piece(ROOK).mg())
+            + (count(color, QUEEN) * eval::piece(QUEEN).mg()));
+}
+
+inline Bitboard Board::check_squares(PieceType piece_type) const noexcept {
+    if (!ply_state().check_squares_known)
+        fill_check_squares();
+    return ply_state().check_squares[piece_type];
 }
 
 // Returns geometric attackers of target, including pinned pieces.
@@ -252,19 +309,33 @@ inline PieceType Board::captured_piece_type(Move move) const noexcept {
 
 // Inline representation mutation
 
+inline void Board::record_dirty_piece(Piece piece, Square from, Square to) noexcept {
+    PlyState& state = ply_state();
+    assert(state.dirty_count < state.dirty_pieces.size());
+    state.dirty_pieces[state.dirty_count++] = {piece, from, to};
+}
+
 // Updates piece storage and incremental scores. apply_hash controls Zobrist
-// updates; callers maintain king_square.
+// updates and dirty-piece records; callers maintain king_square.
 template <bool apply_hash>
 inline void Board::add_piece(Square square, Color color, PieceType piece_type) noexcept {
     assert(squares[square] == NO_PIECE);
 
+    if constexpr (apply_hash)
+        ply_state().material_key ^=
+            zob::hash_material(color, piece_type, piece_counts[color][piece_type]);
+
     piece_counts[color][piece_type]++;
     bb::add(piece_bb[color][piece_type], square);
     bb::add(piece_bb[color][all_pieces_slot], square);
     squares[square] = make_piece(color, piece_type);
     cached_base_terms.add_piece(piece_type, color, square);
-    if constexpr (apply_hash)
+    if constexpr (apply_hash) {
         ply_state().zkey ^= zob::hash_piece(color, piece_type, square);
+        if (piece_type == PAWN)
+            ply_state().pawn_key ^= zob::hash_piece(color, PAWN, square);
+        record_dirty_piece(make_piece(color, piece_type), INVALID, square);
+    }
 }
 
 template <bool apply_hash>
@@ -276,8 +347,14 @@ inline void Board::remove_piece(Square square, Color color, PieceType piece_type
     bb::remove(piece_bb[color][all_pieces_slot], square);
     squares[square] = NO_PIECE;
     cached_base_terms.remove_piece(piece_type, color, square);
-    if constexpr (apply_hash)
+    if constexpr (apply_hash) {
         ply_state().zkey ^= zob::hash_piece(color, piece_type, square);
+        ply_state().material_key ^=
+            zob::hash_material(color, piece_type, piece_counts[color][piece_type]);
+        if (piece_type == PAWN)
+            ply_state().pawn_key ^= zob::hash_piece(color, PAWN, square);
+        record_dirty_piece(make_piece(color, piece_type), square, INVALID);
+    }
 }
 
 template <bool apply_hash>
@@ -290,7 +367,12 @@ inline void Board::move_piece(Square from, Square to, Color color, PieceType pie
     squares[from] = NO_PIECE;
     squares[to]   = make_piece(color, piece_type);
     cached_base_terms.move_piece(piece_type, color, from, to);
-    if constexpr (apply_hash)
-        ply_state().zkey ^=
+    if constexpr (apply_hash) {
+        const PositionKey delta =
             zob::hash_piece(color, piece_type, from) ^ zob::hash_piece(color, piece_type, to);
+        ply_state().zkey ^= delta;
+        if (piece_type == PAWN)
+            ply_state().pawn_key ^= delta;
+        record_dirty_piece(make_piece(color, piece_type), from, to);
+    }
 }
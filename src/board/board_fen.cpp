@@ -25,7 +25,9 @@ void Board::load_fen(std::string_view fen) {
 
     refresh_tactical_cache();
     refresh_legal_enpassant_target();
-    state.zkey = recompute_key();
+    state.zkey         = recompute_key();
+    state.pawn_key     = recompute_pawn_key();
+    state.material_key = recompute_material_key();
 }
 
 std::string Board::to_fen() const {
@@ -4,6 +4,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <initializer_list>
 
 namespace {
 
@@ -35,6 +36,29 @@ clear_rook_castling_right(PlyState& state, Color color, Square rook_square) noex
     }
 }
 
+[[gnu::always_inline]] inline PositionKey
+castling_key_delta(CastlingRights rights, Square from, Square to) noexcept {
+    PositionKey delta = 0;
+
+    for (Color color : {BLACK, WHITE}) {
+        for (CastleSide side : {CASTLE_KINGSIDE, CASTLE_QUEENSIDE}) {
+            const CastlingRights right =
+                side == CASTLE_KINGSIDE ? (color == WHITE ? W_KINGSIDE : B_KINGSIDE)
+                                        : (color == WHITE ? W_QUEENSIDE : B_QUEENSIDE);
+            if (!(rights & right))
+                continue;
+
+            // A right is lost when its king or rook leaves home or its rook is captured.
+            const auto& castling = move_geometry::castling(side, color);
+            if (from == castling.king_from || from == castling.rook_from
+                || to == castling.rook_from)
+                delta ^= zob::hash_castle(side, color);
+        }
+    }
+
+    return delta;
+}
+
 } // namespace
 
 // Precondition: move is legal and non-null.
@@ -164,3 +188,49 @@ void Board::unmake_null() {
     pop_ply_state();
     turn = ~turn;
 }
+
+// Predicts the child key without mutating the board; NULL_MOVE predicts make_null(). Exact
+// except after a double pawn push, where an adjacent enemy pawn is assumed to make the new
+// en-passant target legal. Intended for TT prefetching ahead of make().
+PositionKey Board::key_after(Move move) const noexcept {
+    PositionKey key = this->key() ^ zob::hash_turn();
+    if (legal_enpassant_target() != INVALID)
+        key ^= zob::hash_ep(legal_enpassant_target());
+
+    if (move.is_null())
+        return key;
+
+    const Square    from       = move.from();
+    const Square    to         = move.to();
+    const MoveType  move_type  = move.type();
+    const Color     mover      = turn;
+    const Color     opponent   = ~mover;
+    const PieceType piece_type = piece_type_on(from);
+    const PieceType captured   = captured_piece_type(move);
+
+    if (captured != NO_PIECETYPE) {
+        const Square captured_square =
+            move_type == MOVE_EP ? move_geometry::enpassant_captured_square(to, mover) : to;
+        key ^= zob::hash_piece(opponent, captured, captured_square);
+    }
+
+    const PieceType placed = move_type == MOVE_PROM ? move.prom_piece() : piece_type;
+    key ^= zob::hash_piece(mover, piece_type, from) ^ zob::hash_piece(mover, placed, to);
+
+    if (move_type == MOVE_CASTLE) {
+        const auto& castling = move_geometry::castling(move_geometry::castle_side(from, to), mover);
+        key ^= zob::hash_piece(mover, ROOK, castling.rook_from)
+             ^ zob::hash_piece(mover, ROOK, castling.rook_to);
+    }
+
+    if (castling_rights() != NO_CASTLE)
+        key ^= castling_key_delta(castling_rights(), from, to);
+
+    if (piece_type == PAWN && std::abs(to - from) == pawn_delta::double_push) {
+        const Square target = move_geometry::enpassant_target(to, mover);
+        if (pieces<PAWN>(opponent) & attacks::pawn_attacks(target, mover))
+            key ^= zob::hash_ep(target);
+    }
+
+    return key;
+}
@@ -25,9 +25,8 @@ void copy_array(const T (&source)[Rows][Cols], T (&target)[Rows][Cols]) {
 } // namespace
 
 Board::Board(std::string_view fen) {
-    ply_states.reserve(engine::max_search_ply + 1);
-    ply_states.emplace_back();
-    active_state = &ply_states.back();
+    ply_count    = 1;
+    active_state = &ply_stack[0];
     load_fen(fen);
 }
 
@@ -39,11 +38,27 @@ Board& Board::operator=(const Board& source) {
     if (this == &source)
         return *this;
 
-    assert(!source.ply_states.empty());
+    copy_position(source, source.ply_count);
+    return *this;
+}
+
+void Board::assign_search_root(const Board& source) noexcept {
+    if (this == &source)
+        return;
+
+    const std::size_t reachable = std::min<std::size_t>(source.halfmove_clock(),
+                                                        source.ply_count - 1);
+    copy_position(source, reachable + 1);
+}
+
+// Copies the position and the newest history_plies entries of source's history.
+void Board::copy_position(const Board& source, std::size_t history_plies) noexcept {
+    assert(history_plies > 0 && history_plies <= source.ply_count);
 
-    // Allocate copied history plus search headroom before replacing the position.
-    ply_states.reserve(source.ply_states.size() + engine::max_search_ply);
-    ply_states.assign(source.ply_states.begin(), source.ply_states.end());
+    const PlyState* history_end = source.ply_stack.get() + source.ply_count;
+    std::copy(history_end - history_plies, history_end, ply_stack.get());
+    ply_count    = history_plies;
+    active_state = &ply_stack[ply_count - 1];
 
     copy_array(source.piece_bb, piece_bb);
     copy_array(source.piece_counts, piece_counts);
@@ -52,9 +67,19 @@ Board& Board::operator=(const Board& source) {
     turn              = source.turn;
     absolute_ply      = source.absolute_ply;
     cached_base_terms = source.cached_base_terms;
+}
 
-    active_state = &ply_states.back();
-    return *this;
+// Makes room on a full ply stack by discarding its oldest entries. What remains covers the
+// repetition window and a full search line, so no draw check or pending unmake loses a state.
+void Board::drop_unreachable_history() noexcept {
+    const std::size_t kept = std::max<std::size_t>(ply_state().halfmove_clock + 1,
+                                                   engine::max_search_ply + 1);
+    static_assert(std::max<std::size_t>(repetition_window, engine::max_search_ply + 1)
+                  < ply_capacity);
+
+    std::copy(ply_stack.get() + ply_count - kept, ply_stack.get() + ply_count, ply_stack.get());
+    ply_count    = kept;
+    active_state = &ply_stack[ply_count - 1];
 }
 
 // Reset to the empty, non-playable state used during FEN loading.
@@ -73,8 +98,8 @@ void Board::clear_position() noexcept {
     king_square[BLACK] = INVALID;
     turn               = WHITE;
     absolute_ply       = 0;
-    ply_states.resize(1);
-    active_state = &ply_states.back();
+    ply_count    = 1;
+    active_state = &ply_stack[0];
     ply_state()  = PlyState{};
 }
 
@@ -106,6 +131,31 @@ PositionKey Board::recompute_key() const noexcept {
     return zkey;
 }
 
+// Recompute the pawn-only Zobrist key from piece placement.
+PositionKey Board::recompute_pawn_key() const noexcept {
+    PositionKey pawn_key = 0;
+
+    for (auto sq = A1; sq != INVALID; ++sq) {
+        auto piece = piece_on(sq);
+        if (piece != NO_PIECE && type_of(piece) == PAWN)
+            pawn_key ^= zob::hash_piece(color_of(piece), PAWN, sq);
+    }
+
+    return pawn_key;
+}
+
+// Recompute the material key from piece counts; each present piece keys its count index.
+PositionKey Board::recompute_material_key() const noexcept {
+    PositionKey material_key = 0;
+
+    for (int c = BLACK; c < N_COLORS; ++c)
+        for (int p = PAWN; p <= KING; ++p)
+            for (int n = 0; n < count(Color(c), PieceType(p)); ++n)
+                material_key ^= zob::hash_material(Color(c), PieceType(p), n);
+
+    return material_key;
+}
+
 // Recompute the Board-owned HCE base terms independently of the incremental cache.
 eval::BaseTerms Board::recompute_base_terms() const noexcept {
     eval::BaseTerms result;
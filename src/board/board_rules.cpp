@@ -1,5 +1,6 @@
 #include "board/board.hpp"
 
+#include "board/cuckoo.hpp"
 #include "core/attacks.hpp"
 #include "core/move_geometry.hpp"
 #include "core/square.hpp"
@@ -61,22 +62,6 @@ bool is_king_safe_after_move(const Board& board, Move move) noexcept {
         || bb::contains(square::collinear(from, to), king);
 }
 
-[[gnu::always_inline]] inline Bitboard direct_check_targets(const Board& board,
-                                                            PieceType    piece_type) noexcept {
-    const Color    opponent      = ~board.side_to_move();
-    const Square   opponent_king = board.king_sq(opponent);
-    const Bitboard occupancy     = board.occupancy();
-
-    switch (piece_type) {
-    case PAWN:   return attacks::pawn_attacks(opponent_king, opponent);
-    case KNIGHT: return attacks::piece_moves<KNIGHT>(opponent_king);
-    case BISHOP: return attacks::piece_moves<BISHOP>(opponent_king, occupancy);
-    case ROOK:   return attacks::piece_moves<ROOK>(opponent_king, occupancy);
-    case QUEEN:  return attacks::piece_moves<QUEEN>(opponent_king, occupancy);
-    default:     return 0;
-    }
-}
-
 } // namespace
 
 // Tactical cache maintenance
@@ -94,6 +79,21 @@ void Board::refresh_tactical_cache() noexcept {
         king_sq(WHITE), pieces<BISHOP, QUEEN>(BLACK), pieces<ROOK, QUEEN>(BLACK), occupancy);
     state.blockers[BLACK] = attacks::slider_blockers(
         king_sq(BLACK), pieces<BISHOP, QUEEN>(WHITE), pieces<ROOK, QUEEN>(WHITE), occupancy);
+    state.check_squares_known = false;
+}
+
+void Board::fill_check_squares() const noexcept {
+    const PlyState& state         = ply_state();
+    const Color     opponent      = ~side_to_move();
+    const Square    opponent_king = king_sq(opponent);
+    const Bitboard  occupancy     = this->occupancy();
+
+    state.check_squares[PAWN]   = attacks::pawn_attacks(opponent_king, opponent);
+    state.check_squares[KNIGHT] = attacks::piece_moves<KNIGHT>(opponent_king);
+    state.check_squares[BISHOP] = attacks::piece_moves<BISHOP>(opponent_king, occupancy);
+    state.check_squares[ROOK]   = attacks::piece_moves<ROOK>(opponent_king, occupancy);
+    state.check_squares[QUEEN]  = state.check_squares[BISHOP] | state.check_squares[ROOK];
+    state.check_squares_known   = true;
 }
 
 void Board::refresh_legal_enpassant_target() noexcept {
@@ -245,7 +245,7 @@ bool Board::gives_check(Move move) const noexcept {
 
     // Handle direct and discovered checks.
     const PieceType piece_type = type_of(piece_on(from));
-    if (bb::contains(direct_check_targets(*this, piece_type), to))
+    if (bb::contains(check_squares(piece_type), to))
         return true;
     if (bb::contains(blockers(opponent), from)
         && !bb::contains(square::collinear(from, to), opponent_king))
@@ -294,7 +294,7 @@ bool Board::is_draw(int ply_from_search_root) const noexcept {
         return true;
 
     const PositionKey current_key   = key();
-    const std::size_t current_index = ply_states.size() - 1;
+    const std::size_t current_index = ply_count - 1;
     const std::size_t search_ply    = static_cast<std::size_t>(ply_from_search_root);
     const std::size_t reversible_history_plies =
         std::min<std::size_t>(halfmove_clock(), current_index);
@@ -303,7 +303,7 @@ bool Board::is_draw(int ply_from_search_root) const noexcept {
     for (std::size_t plies_back = 2; plies_back <= reversible_history_plies; plies_back += 2) {
         const std::size_t index = current_index - plies_back;
 
-        if (ply_states[index].zkey != current_key)
+        if (ply_stack[index].zkey != current_key)
             continue;
 
         // One prior occurrence strictly after the search root is a cycle draw.
@@ -317,3 +317,50 @@ bool Board::is_draw(int ply_from_search_root) const noexcept {
 
     return false;
 }
+
+// Detects a reversible move for the side to move back to a position in the reversible history.
+// The opponent's moves since a candidate position must cancel; the remaining key change is then
+// looked up as one reversible move, so each candidate costs O(1). A target after the search root
+// draws at once, as in is_draw; one at or before it must already repeat. Null moves end the
+// history considered.
+bool Board::has_game_cycle(int ply_from_search_root) const noexcept {
+    assert(ply_from_search_root >= 0);
+
+    const std::size_t current_index = ply_count - 1;
+    const std::size_t search_ply    = static_cast<std::size_t>(ply_from_search_root);
+    const std::size_t reversible_history_plies =
+        std::min<std::size_t>(halfmove_clock(), current_index);
+    if (reversible_history_plies < 3 || previous_move().is_null())
+        return false;
+
+    const PositionKey current_key   = key();
+    const std::size_t oldest_index  = current_index - reversible_history_plies;
+    PositionKey       opponent_keys = current_key ^ ply_stack[current_index - 1].zkey
+                                    ^ zob::hash_turn();
+
+    for (std::size_t plies_back = 3; plies_back <= reversible_history_plies; plies_back += 2) {
+        const std::size_t index = current_index - plies_back;
+        if (ply_stack[index + 2].previous_move.is_null()
+            || ply_stack[index + 1].previous_move.is_null())
+            return false;
+
+        opponent_keys ^= ply_stack[index + 1].zkey ^ ply_stack[index].zkey ^ zob::hash_turn();
+        if (opponent_keys != 0)
+            continue;
+
+        const PositionKey target = ply_stack[index].zkey;
+        const Move        move   = cuckoo::reversible_move(current_key ^ target);
+        if (move.is_null() || (square::between(move.from(), move.to()) & occupancy()))
+            continue;
+
+        if (plies_back < search_ply)
+            return true;
+        for (std::size_t earlier = index; earlier >= oldest_index + 2;) {
+            earlier -= 2;
+            if (ply_stack[earlier].zkey == target)
+                return true;
+        }
+    }
+
+    return false;
+}
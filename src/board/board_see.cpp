@@ -12,9 +12,9 @@ namespace {
 constexpr PieceType see_attacker_order[] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING};
 
 EvalValue see_initial_gain(const Board& board, Move move) noexcept {
-    EvalValue gain = eval::piece(board.captured_piece_type(move)).mg;
+    EvalValue gain = eval::piece(board.captured_piece_type(move)).mg();
     if (move.type() == MOVE_PROM)
-        gain += eval::piece(move.prom_piece()).mg - eval::piece(PAWN).mg;
+        gain += eval::piece(move.prom_piece()).mg() - eval::piece(PAWN).mg();
 
     return gain;
 }
@@ -58,12 +58,9 @@ EvalValue Board::see(Move move) const noexcept {
         ++depth;
         side = ~side;
 
-        gains[depth] = eval::piece(piece_type).mg - gains[depth - 1];
-        // If stopping and continuing are both losing for the side to move,
-        // deeper recaptures cannot change the backed-up result.
-        if (std::max(-gains[depth - 1], gains[depth]) < 0)
-            break;
-
+        // Every recapture is kept: pruning once both options lose would keep the sign of the
+        // result but not its size, and see_ge() callers compare against nonzero thresholds.
+        gains[depth] = eval::piece(piece_type).mg() - gains[depth - 1];
         occupancy ^= current_attacker;
 
         // Removing the recapturer can reveal x-ray bishop, rook, or queen attacks.
@@ -71,24 +68,7 @@ EvalValue Board::see(Move move) const noexcept {
                    | (attacks::piece_moves<ROOK>(to, occupancy) & rook_sliders);
         attackers &= occupancy;
 
-        current_attacker = 0;
-        for (PieceType attacker_type : see_attacker_order) {
-            Bitboard candidate_attacker = attackers & piece_bb[side][attacker_type];
-            if (!candidate_attacker)
-                continue;
-
-            candidate_attacker = bb::lsb_mask(candidate_attacker);
-            if (attacker_type == KING) {
-                // A king cannot recapture onto a square still attacked by the opponent.
-                const Bitboard kingless_occupancy = occupancy ^ candidate_attacker;
-                if (attacks_to(to, ~side, kingless_occupancy) & kingless_occupancy)
-                    continue;
-            }
-
-            piece_type       = attacker_type;
-            current_attacker = candidate_attacker;
-            break;
-        }
+        current_attacker = least_valuable_attacker(to, side, attackers, occupancy, piece_type);
     } while (current_attacker);
 
     // Negamax the swap-list to get the final exchange value.
@@ -97,3 +77,91 @@ EvalValue Board::see(Move move) const noexcept {
 
     return gains[0];
 }
+
+// Walks the same exchange as see(), but tracks only the balance against threshold. Each
+// recapture flips which side the threshold currently favours; the walk stops once the side
+// to move cannot turn the result back even by winning the piece it captures.
+bool Board::see_ge(Move move, EvalValue threshold) const noexcept {
+    assert(is_pseudo_legal(move));
+
+    // The rook and king land on squares the opponent cannot attack.
+    if (move.type() == MOVE_CASTLE)
+        return threshold <= 0;
+
+    const Square from = move.from();
+    const Square to   = move.to();
+
+    // The balance after the move, as if it goes unanswered.
+    EvalValue balance = see_initial_gain(*this, move) - threshold;
+    if (balance < 0)
+        return false;
+
+    // The balance after losing the moved piece for nothing, from the opponent's view.
+    PieceType piece_type = move.type() == MOVE_PROM ? move.prom_piece() : piece_type_on(from);
+    balance              = eval::piece(piece_type).mg() - balance;
+    if (balance <= 0)
+        return true;
+
+    Color    side             = side_to_move();
+    Bitboard occupancy        = this->occupancy() ^ bb::set(from);
+    Bitboard current_attacker = 0;
+
+    if (move.type() == MOVE_EP)
+        bb::remove(occupancy, move_geometry::enpassant_captured_square(to, side));
+    bb::add(occupancy, to);
+
+    Bitboard attackers = all_attackers_to(to, occupancy) & occupancy;
+
+    const Bitboard bishop_sliders = pieces<BISHOP, QUEEN>();
+    const Bitboard rook_sliders   = pieces<ROOK, QUEEN>();
+
+    // Whether the threshold holds if the side to move stops here.
+    bool holds = true;
+    while (true) {
+        side             = ~side;
+        current_attacker = least_valuable_attacker(to, side, attackers, occupancy, piece_type);
+        if (!current_attacker)
+            break;
+
+        // The recapture hands the result to the side to move unless it loses even after
+        // keeping the piece it just took.
+        holds   = !holds;
+        balance = eval::piece(piece_type).mg() - balance;
+        if (balance < EvalValue(holds))
+            break;
+
+        occupancy ^= current_attacker;
+        attackers |= (attacks::piece_moves<BISHOP>(to, occupancy) & bishop_sliders)
+                   | (attacks::piece_moves<ROOK>(to, occupancy) & rook_sliders);
+        attackers &= occupancy;
+    }
+
+    return holds;
+}
+
+// The least valuable of side's attackers on to, with its type in attacker_type; empty when
+// side has none it can legally recapture with.
+Bitboard Board::least_valuable_attacker(Square     to,
+                                        Color      side,
+                                        Bitboard   attackers,
+                                        Bitboard   occupancy,
+                                        PieceType& attacker_type) const noexcept {
+    for (PieceType candidate_type : see_attacker_order) {
+        Bitboard candidate_attacker = attackers & piece_bb[side][candidate_type];
+        if (!candidate_attacker)
+            continue;
+
+        candidate_attacker = bb::lsb_mask(candidate_attacker);
+        if (candidate_type == KING) {
+            // A king cannot recapture onto a square still attacked by the opponent.
+            const Bitboard kingless_occupancy = occupancy ^ candidate_attacker;
+            if (attacks_to(to, ~side, kingless_occupancy) & kingless_occupancy)
+                continue;
+        }
+
+        attacker_type = candidate_type;
+        return candidate_attacker;
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "board/zobrist.hpp"
+#include "core/attacks.hpp"
+#include "core/move.hpp"
+#include "core/piece.hpp"
+#include "core/square.hpp"
+#include "core/types.hpp"
+
+namespace cuckoo {
+
+// Immutable backing storage; production code uses the accessor below.
+namespace storage {
+
+/**
+ * Every reversible move, keyed by the Zobrist change it makes including the side to move.
+ * A reversible move is a knight, bishop, rook, queen, or king move between two squares it
+ * connects on an empty board. Both directions share one key. Keys live in a two-choice cuckoo
+ * hash, so a lookup probes at most two slots.
+ */
+struct Table {
+    static constexpr std::size_t size = 8192;
+    // Knight, bishop, rook, queen, and king square pairs, both colors.
+    static constexpr std::size_t reversible_moves = 3668;
+
+    static constexpr std::size_t first_slot(PositionKey key) noexcept {
+        return key & (size - 1);
+    }
+
+    static constexpr std::size_t second_slot(PositionKey key) noexcept {
+        return (key >> 16) & (size - 1);
+    }
+
+    static constexpr bool connects(PieceType piece_type, Square from, Square to) noexcept {
+        const bool orthogonal = square::rank_of(from) == square::rank_of(to)
+                             || square::file_of(from) == square::file_of(to);
+        const bool diagonal   = !orthogonal && square::collinear(from, to) != 0;
+
+        switch (piece_type) {
+        case KNIGHT: return bb::contains(attacks::tables::knight_moves[from], to);
+        case BISHOP: return diagonal;
+        case ROOK:   return orthogonal;
+        case QUEEN:  return orthogonal || diagonal;
+        case KING:   return bb::contains(attacks::tables::king_moves[from], to);
+        default:     return false;
+        }
+    }
+
+    // Insert each move, displacing occupants to their other slot until one lands empty.
+    consteval Table() noexcept {
+        for (Color color : {BLACK, WHITE}) {
+            for (PieceType piece_type : {KNIGHT, BISHOP, ROOK, QUEEN, KING}) {
+                for (Square from = A1; from < INVALID; ++from) {
+                    for (Square to = from + 1; to < INVALID; ++to) {
+                        if (!connects(piece_type, from, to))
+                            continue;
+
+                        PositionKey key  = zob::hash_piece(color, piece_type, from)
+                                        ^ zob::hash_piece(color, piece_type, to)
+                                        ^ zob::hash_turn();
+                        Move        move = Move(from, to);
+                        std::size_t slot = first_slot(key);
+                        while (true) {
+                            std::swap(keys[slot], key);
+                            std::swap(moves[slot], move);
+                            if (move.is_null())
+                                break;
+                            slot = slot == first_slot(key) ? second_slot(key) : first_slot(key);
+                        }
+                        ++entries;
+                    }
+                }
+            }
+        }
+    }
+
+    PositionKey keys[size]{};
+    Move        moves[size]{};
+    std::size_t entries{};
+};
+
+inline constexpr Table table{};
+
+static_assert(table.entries == Table::reversible_moves);
+
+} // namespace storage
+
+// The reversible move, in either direction, whose Zobrist change is key_delta; NULL_MOVE when
+// none makes that change.
+[[nodiscard]] constexpr Move reversible_move(PositionKey key_delta) noexcept {
+    using storage::Table;
+
+    if (std::size_t slot = Table::first_slot(key_delta); storage::table.keys[slot] == key_delta)
+        return storage::table.moves[slot];
+    if (std::size_t slot = Table::second_slot(key_delta); storage::table.keys[slot] == key_delta)
+        return storage::table.moves[slot];
+    return NULL_MOVE;
+}
+
+} // namespace cuckoo
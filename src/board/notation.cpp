@@ -51,11 +51,7 @@ void append_disambiguation(std::string& san, const Board& board, Move move, Piec
 }
 
 bool has_legal_reply(const Board& board) {
-    for (const Move reply : movegen::generate_pseudo_legal(board)) {
-        if (board.is_legal_pseudo_move(reply))
-            return true;
-    }
-    return false;
+    return !movegen::generate_legal(board).empty();
 }
 
 } // namespace
@@ -10,6 +10,16 @@
 #include "core/square.hpp"
 #include "core/types.hpp"
 
+/**
+ * One piece placement change made by a move: a placement moves from one square to another,
+ * while an added piece has from INVALID and a removed piece has to INVALID.
+ */
+struct DirtyPiece {
+    Piece  piece{NO_PIECE};
+    Square from{INVALID};
+    Square to{INVALID};
+};
+
 /** One entry in Board's reversible history stack. */
 struct PlyState {
     // Cached tactical data for this position.
@@ -21,7 +31,11 @@ struct PlyState {
 
     // Rule state and position key.
     // Full Zobrist key; en passant is keyed only through legal_enpassant_target.
-    PositionKey    zkey{};
+    PositionKey zkey{};
+    // Zobrist key over pawn placement only; indexes the evaluator's pawn-structure cache.
+    PositionKey pawn_key{};
+    // Key over piece counts only; indexes the evaluator's material table.
+    PositionKey    material_key{};
     CastlingRights castling_rights{NO_CASTLE};
     // FEN target after a double pawn push; it need not be capturable.
     Square enpassant_target{INVALID};
@@ -35,4 +49,14 @@ struct PlyState {
     Move previous_move{NULL_MOVE};
     // Captured type removed by previous_move, or NO_PIECETYPE when none.
     PieceType captured_piece_type{NO_PIECETYPE};
+    // Placement changes made by previous_move, in order; a capturing promotion needs four.
+    // Empty after FEN load or a null move. Incremental evaluators replay them.
+    std::array<DirtyPiece, 4> dirty_pieces{};
+    std::uint8_t              dirty_count{};
+
+    // Per piece type, squares from which a side-to-move piece of that type would directly check
+    // the opposing king; kings never do. Filled on first use, where check_squares_known is set,
+    // so make() and perft leaves that never ask do not pay for the slider lookups.
+    mutable std::array<Bitboard, N_PIECETYPES> check_squares{};
+    mutable bool                               check_squares_known{};
 };
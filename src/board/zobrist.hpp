@@ -59,6 +59,12 @@ hash_piece(Color color, PieceType piece, Square square) noexcept {
     return storage::table.piece_keys[color][piece][square];
 }
 
+// Material keys reuse the piece-square keys, indexed by piece count instead of square.
+[[nodiscard]] constexpr PositionKey
+hash_material(Color color, PieceType piece, int count) noexcept {
+    return storage::table.piece_keys[color][piece][count];
+}
+
 [[nodiscard]] constexpr PositionKey hash_turn() noexcept {
     return storage::table.turn_key;
 }
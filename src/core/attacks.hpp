@@ -4,6 +4,7 @@
 #include <cstddef>
 
 #include "core/attacks_magic.hpp"
+#include "core/attacks_pext.hpp"
 #include "core/bitboard.hpp"
 #include "core/piece.hpp"
 #include "core/square.hpp"
@@ -53,11 +54,21 @@ constexpr std::array<Bitboard, N_SQUARES> king_moves =
 
 namespace attacks {
 
-// Initializes magic slider attack tables. Call once before using bishop, rook,
-// or queen attacks. Pawn, knight, and king attack tables are constexpr and do
-// not depend on initialization.
-inline void init() {
-    magic::init();
+// Slider attack tables are generated at compile time, so lookups need no initialization. The
+// PEXT backend serves them when the CPU has a fast PEXT, and magics otherwise.
+
+// Bishop attacks from the selected backend.
+inline Bitboard bishop_moves(Square sq, Bitboard occupancy) {
+    if (pext::compiled && pext::enabled)
+        return pext::bishop_moves(sq, occupancy);
+    return magic::bishop_moves(sq, occupancy);
+}
+
+// Rook attacks from the selected backend.
+inline Bitboard rook_moves(Square sq, Bitboard occupancy) {
+    if (pext::compiled && pext::enabled)
+        return pext::rook_moves(sq, occupancy);
+    return magic::rook_moves(sq, occupancy);
 }
 
 // Compile-time dispatch for piece attacks when the piece type is known.
@@ -65,9 +76,9 @@ template <PieceType p>
 constexpr Bitboard piece_moves(Square sq, Bitboard occupancy = 0) {
     switch (p) {
     case KNIGHT: return tables::knight_moves[sq];
-    case BISHOP: return magic::bishop_moves(sq, occupancy);
-    case ROOK:   return magic::rook_moves(sq, occupancy);
-    case QUEEN:  return magic::queen_moves(sq, occupancy);
+    case BISHOP: return bishop_moves(sq, occupancy);
+    case ROOK:   return rook_moves(sq, occupancy);
+    case QUEEN:  return bishop_moves(sq, occupancy) | rook_moves(sq, occupancy);
     case KING:   return tables::king_moves[sq];
     default:     return 0;
     }
@@ -77,9 +88,9 @@ constexpr Bitboard piece_moves(Square sq, Bitboard occupancy = 0) {
 constexpr Bitboard piece_moves(Square sq, PieceType p, Bitboard occupancy) {
     switch (p) {
     case KNIGHT: return tables::knight_moves[sq];
-    case BISHOP: return magic::bishop_moves(sq, occupancy);
-    case ROOK:   return magic::rook_moves(sq, occupancy);
-    case QUEEN:  return magic::queen_moves(sq, occupancy);
+    case BISHOP: return bishop_moves(sq, occupancy);
+    case ROOK:   return rook_moves(sq, occupancy);
+    case QUEEN:  return bishop_moves(sq, occupancy) | rook_moves(sq, occupancy);
     case KING:   return tables::king_moves[sq];
     default:     return 0;
     }
@@ -29,59 +29,36 @@
 
 #include "core/attacks_magic.hpp"
 
-#include <array>
-#include <cstddef>
 #include <cstdint>
-#include <utility>
-#include <vector>
 
 #include "core/bitboard.hpp"
+#include "core/slider_attacks.hpp"
 
 namespace attacks::magic {
 
-// Dense backing stores for all generated attacks.
-Bitboard rook_table[102400];
-Bitboard bishop_table[5248];
-
-// Per-square slice heads into the dense tables.
-Bitboard* const rook_moves_table[64] = {
-    rook_table + 86016, rook_table + 73728, rook_table + 36864, rook_table + 43008,
-    rook_table + 47104, rook_table + 51200, rook_table + 77824, rook_table + 94208,
-    rook_table + 69632, rook_table + 32768, rook_table + 38912, rook_table + 10240,
-    rook_table + 14336, rook_table + 53248, rook_table + 57344, rook_table + 81920,
-    rook_table + 24576, rook_table + 33792, rook_table + 6144,  rook_table + 11264,
-    rook_table + 15360, rook_table + 18432, rook_table + 58368, rook_table + 61440,
-    rook_table + 26624, rook_table + 4096,  rook_table + 7168,  rook_table + 0,
-    rook_table + 2048,  rook_table + 19456, rook_table + 22528, rook_table + 63488,
-    rook_table + 28672, rook_table + 5120,  rook_table + 8192,  rook_table + 1024,
-    rook_table + 3072,  rook_table + 20480, rook_table + 23552, rook_table + 65536,
-    rook_table + 30720, rook_table + 34816, rook_table + 9216,  rook_table + 12288,
-    rook_table + 16384, rook_table + 21504, rook_table + 59392, rook_table + 67584,
-    rook_table + 71680, rook_table + 35840, rook_table + 39936, rook_table + 13312,
-    rook_table + 17408, rook_table + 54272, rook_table + 60416, rook_table + 83968,
-    rook_table + 90112, rook_table + 75776, rook_table + 40960, rook_table + 45056,
-    rook_table + 49152, rook_table + 55296, rook_table + 79872, rook_table + 98304};
-
-Bitboard* const bishop_moves_table[64] = {
-    bishop_table + 4992, bishop_table + 2624, bishop_table + 256,  bishop_table + 896,
-    bishop_table + 1280, bishop_table + 1664, bishop_table + 4800, bishop_table + 5120,
-    bishop_table + 2560, bishop_table + 2656, bishop_table + 288,  bishop_table + 928,
-    bishop_table + 1312, bishop_table + 1696, bishop_table + 4832, bishop_table + 4928,
-    bishop_table + 0,    bishop_table + 128,  bishop_table + 320,  bishop_table + 960,
-    bishop_table + 1344, bishop_table + 1728, bishop_table + 2304, bishop_table + 2432,
-    bishop_table + 32,   bishop_table + 160,  bishop_table + 448,  bishop_table + 2752,
-    bishop_table + 3776, bishop_table + 1856, bishop_table + 2336, bishop_table + 2464,
-    bishop_table + 64,   bishop_table + 192,  bishop_table + 576,  bishop_table + 3264,
-    bishop_table + 4288, bishop_table + 1984, bishop_table + 2368, bishop_table + 2496,
-    bishop_table + 96,   bishop_table + 224,  bishop_table + 704,  bishop_table + 1088,
-    bishop_table + 1472, bishop_table + 2112, bishop_table + 2400, bishop_table + 2528,
-    bishop_table + 2592, bishop_table + 2688, bishop_table + 832,  bishop_table + 1216,
-    bishop_table + 1600, bishop_table + 2240, bishop_table + 4864, bishop_table + 4960,
-    bishop_table + 5056, bishop_table + 2720, bishop_table + 864,  bishop_table + 1248,
-    bishop_table + 1632, bishop_table + 2272, bishop_table + 4896, bishop_table + 5184};
+// Start of each square's slice within the dense tables.
+constexpr std::uint32_t rook_offset[64] = {
+    86016, 73728, 36864, 43008, 47104, 51200, 77824, 94208,
+    69632, 32768, 38912, 10240, 14336, 53248, 57344, 81920,
+    24576, 33792,  6144, 11264, 15360, 18432, 58368, 61440,
+    26624,  4096,  7168,     0,  2048, 19456, 22528, 63488,
+    28672,  5120,  8192,  1024,  3072, 20480, 23552, 65536,
+    30720, 34816,  9216, 12288, 16384, 21504, 59392, 67584,
+    71680, 35840, 39936, 13312, 17408, 54272, 60416, 83968,
+    90112, 75776, 40960, 45056, 49152, 55296, 79872, 98304};
+
+constexpr std::uint32_t bishop_offset[64] = {
+    4992, 2624,  256,  896, 1280, 1664, 4800, 5120,
+    2560, 2656,  288,  928, 1312, 1696, 4832, 4928,
+       0,  128,  320,  960, 1344, 1728, 2304, 2432,
+      32,  160,  448, 2752, 3776, 1856, 2336, 2464,
+      64,  192,  576, 3264, 4288, 1984, 2368, 2496,
+      96,  224,  704, 1088, 1472, 2112, 2400, 2528,
+    2592, 2688,  832, 1216, 1600, 2240, 4864, 4960,
+    5056, 2720,  864, 1248, 1632, 2272, 4896, 5184};
 
 // Per-square multipliers for hashing relevant blockers.
-const std::uint64_t rook_magic[64] = {
+constexpr std::uint64_t rook_magic[64] = {
     0x0080001020400080ull, 0x0040001000200040ull, 0x0080081000200080ull, 0x0080040800100080ull,
     0x0080020400080080ull, 0x0080010200040080ull, 0x0080008001000200ull, 0x0080002040800100ull,
     0x0000800020400080ull, 0x0000400020005000ull, 0x0000801000200080ull, 0x0000800800100080ull,
@@ -99,7 +76,7 @@ const std::uint64_t rook_magic[64] = {
     0x00FFFCDDFCED714Aull, 0x007FFCDDFCED714Aull, 0x003FFFCDFFD88096ull, 0x0000040810002101ull,
     0x0001000204080011ull, 0x0001000204000801ull, 0x0001000082000401ull, 0x0001FFFAABFAD1A2ull};
 
-const std::uint64_t bishop_magic[64] = {
+constexpr std::uint64_t bishop_magic[64] = {
     0x0002020202020200ull, 0x0002020202020000ull, 0x0004010202000000ull, 0x0004040080000000ull,
     0x0001104000000000ull, 0x0000821040000000ull, 0x0000410410400000ull, 0x0000104104104000ull,
     0x0000040404040400ull, 0x0000020202020200ull, 0x0000040102020000ull, 0x0000040400800000ull,
@@ -119,7 +96,7 @@ const std::uint64_t bishop_magic[64] = {
 
 // Relevant blocker masks. Edge blockers are still attacked, with no farther
 // squares behind them, so they do not affect the lookup key.
-const Bitboard rook_mask[64] = {
+constexpr Bitboard rook_mask[64] = {
     0x000101010101017Eull, 0x000202020202027Cull, 0x000404040404047Aull, 0x0008080808080876ull,
     0x001010101010106Eull, 0x002020202020205Eull, 0x004040404040403Eull, 0x008080808080807Eull,
     0x0001010101017E00ull, 0x0002020202027C00ull, 0x0004040404047A00ull, 0x0008080808087600ull,
@@ -137,7 +114,7 @@ const Bitboard rook_mask[64] = {
     0x7E01010101010100ull, 0x7C02020202020200ull, 0x7A04040404040400ull, 0x7608080808080800ull,
     0x6E10101010101000ull, 0x5E20202020202000ull, 0x3E40404040404000ull, 0x7E80808080808000ull};
 
-const Bitboard bishop_mask[64] = {
+constexpr Bitboard bishop_mask[64] = {
     0x0040201008040200ull, 0x0000402010080400ull, 0x0000004020100A00ull, 0x0000000040221400ull,
     0x0000000002442800ull, 0x0000000204085000ull, 0x0000020408102000ull, 0x0002040810204000ull,
     0x0020100804020000ull, 0x0040201008040000ull, 0x00004020100A0000ull, 0x0000004022140000ull,
@@ -156,89 +133,51 @@ const Bitboard bishop_mask[64] = {
     0x0028440200000000ull, 0x0050080402000000ull, 0x0020100804020000ull, 0x0040201008040200ull};
 
 // Right shifts that compact each magic product into its table slice.
-const int rook_shift[64] = {52, 53, 53, 53, 53, 53, 53, 52, 53, 54, 54, 54, 54, 54, 54, 53,
-                            53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 54, 54, 54, 54, 53,
-                            53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 54, 54, 54, 54, 53,
-                            53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 53, 53, 53, 53, 53};
-
-const int bishop_shift[64] = {58, 59, 59, 59, 59, 59, 59, 58, 59, 59, 59, 59, 59, 59, 59, 59,
-                              59, 59, 57, 57, 57, 57, 59, 59, 59, 59, 57, 55, 55, 57, 59, 59,
-                              59, 59, 57, 55, 55, 57, 59, 59, 59, 59, 57, 57, 57, 57, 59, 59,
-                              59, 59, 59, 59, 59, 59, 59, 59, 58, 59, 59, 59, 59, 59, 59, 58};
-
-// File/rank delta for one slider ray.
-using SliderDirection  = std::pair<int, int>;
-using SliderDirections = std::array<SliderDirection, 4>;
-
-// Slow slider walk used only while building lookup tables.
-Bitboard generate_slider_moves(Square from, Bitboard occupied, const SliderDirections& directions) {
-    Bitboard attacks = 0ULL;
-
-    for (const SliderDirection& direction : directions) {
-        const int file_delta = direction.first;
-        const int rank_delta = direction.second;
-
-        // Start one step away; the source square is never attacked.
-        int file = square::file_of(from) + file_delta;
-        int rank = square::rank_of(from) + rank_delta;
-
-        while (0 <= rank && rank < 8 && 0 <= file && file < 8) {
-            const Bitboard to_bb = bb::set(square::make(File(file), Rank(rank)));
-
-            attacks |= to_bb;
-            if (occupied & to_bb)
-                break;
-
-            file += file_delta;
-            rank += rank_delta;
-        }
-    }
-
-    return attacks;
-}
-
-// Decode subset bits onto the mask squares: bit i controls squares[i].
-Bitboard reconstruct_occupancy(const std::vector<Square>& squares, std::uint64_t subset) {
-    Bitboard occupied = 0;
-    for (std::size_t i = 0; i < squares.size(); i++) {
-        if (bb::contains(subset, Square(i)))
-            bb::add(occupied, squares[i]);
+constexpr int rook_shift[64] = {52, 53, 53, 53, 53, 53, 53, 52, 53, 54, 54, 54, 54, 54, 54, 53,
+                                53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 54, 54, 54, 54, 53,
+                                53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 54, 54, 54, 54, 53,
+                                53, 54, 54, 54, 54, 54, 54, 53, 53, 54, 54, 53, 53, 53, 53, 53};
+
+constexpr int bishop_shift[64] = {58, 59, 59, 59, 59, 59, 59, 58, 59, 59, 59, 59, 59, 59, 59, 59,
+                                  59, 59, 57, 57, 57, 57, 59, 59, 59, 59, 57, 55, 55, 57, 59, 59,
+                                  59, 59, 57, 55, 55, 57, 59, 59, 59, 59, 57, 57, 57, 57, 59, 59,
+                                  59, 59, 59, 59, 59, 59, 59, 59, 58, 59, 59, 59, 59, 59, 59, 58};
+
+namespace {
+
+// Fill each square's slice with attacks for every blocker subset of its mask.
+consteval void fill_slider_table(const slider::Rays& rays,
+                                 PieceType           slider,
+                                 const Bitboard      masks[64],
+                                 const std::uint64_t magic_nums[64],
+                                 const int           shifts[64],
+                                 const std::uint32_t offsets[64],
+                                 Bitboard*           table) {
+    for (Square sq = A1; sq < INVALID; ++sq) {
+        const Bitboard mask     = masks[sq];
+        Bitboard       occupied = 0;
+
+        // Carry-rippler: visits each subset of mask once, ending back at the empty set.
+        do {
+            const std::uint64_t index = (occupied * magic_nums[sq]) >> shifts[sq];
+            table[offsets[sq] + index] = rays.moves(slider, sq, occupied);
+            occupied                  = (occupied - mask) & mask;
+        } while (occupied);
     }
-    return occupied;
 }
 
-// Fill each square's slice with attacks for every blocker subset.
-void init_slider_magic(const Bitboard          masks[64],
-                       const std::uint64_t     magic_nums[64],
-                       const int               shifts[64],
-                       Bitboard* const         moves[64],
-                       const SliderDirections& directions) {
+consteval AttackTables make_tables() {
+    const slider::Rays rays;
+    AttackTables       result{};
 
-    for (Square sq = A1; sq < INVALID; ++sq) {
-        Bitboard mask = masks[sq];
-
-        std::vector<Square> squares;
-        while (mask)
-            squares.push_back(bb::lsb_pop(mask));
-
-        // There are 2^N subsets for N relevant blocker squares.
-        Bitboard max_occ = bb::set(Square(squares.size()));
-        for (std::uint64_t subset = 0; subset < max_occ; subset++) {
-            Bitboard      occupied = reconstruct_occupancy(squares, subset);
-            std::uint64_t offset   = (occupied * magic_nums[sq]) >> shifts[sq];
-
-            *(moves[sq] + offset) = generate_slider_moves(sq, occupied, directions);
-        }
-    }
+    fill_slider_table(rays, BISHOP, bishop_mask, bishop_magic, bishop_shift, bishop_offset,
+                      result.bishop);
+    fill_slider_table(rays, ROOK, rook_mask, rook_magic, rook_shift, rook_offset, result.rook);
+    return result;
 }
 
-void init() {
-    // Directions are file/rank deltas from the source square.
-    SliderDirections bishop_dirs = {{{-1, 1}, {1, 1}, {-1, -1}, {1, -1}}};
-    SliderDirections rook_dirs   = {{{0, 1}, {1, 0}, {0, -1}, {-1, 0}}};
+} // namespace
 
-    init_slider_magic(bishop_mask, bishop_magic, bishop_shift, bishop_moves_table, bishop_dirs);
-    init_slider_magic(rook_mask, rook_magic, rook_shift, rook_moves_table, rook_dirs);
-}
+constinit const AttackTables tables = make_tables();
 
 } // namespace attacks::magic
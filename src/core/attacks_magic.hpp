@@ -35,11 +35,16 @@
 
 namespace attacks::magic {
 
-// Dense backing storage; *_moves_table[sq] points at sq's slice.
-extern Bitboard        rook_table[102400];
-extern Bitboard        bishop_table[5248];
-extern Bitboard* const rook_moves_table[64];
-extern Bitboard* const bishop_moves_table[64];
+// Attacks for every relevant blocker subset, generated at compile time into read-only storage.
+// Each square's slice starts at its *_offset and is indexed by the hashed blockers.
+struct AttackTables {
+    Bitboard rook[102400];
+    Bitboard bishop[5248];
+};
+
+extern const AttackTables  tables;
+extern const std::uint32_t rook_offset[64];
+extern const std::uint32_t bishop_offset[64];
 
 // Per-square blocker masks, hash multipliers, and shifts.
 extern const std::uint64_t rook_magic[64];
@@ -49,21 +54,18 @@ extern const Bitboard      bishop_mask[64];
 extern const int           rook_shift[64];
 extern const int           bishop_shift[64];
 
-// Populates rook_table and bishop_table once at startup.
-void init();
-
 // Keep relevant blockers, hash the subset, then index sq's slice.
 inline Bitboard rook_moves(Square sq, Bitboard occupied) {
     const Bitboard      occ   = occupied & rook_mask[sq];
     const std::uint64_t index = (occ * rook_magic[sq]) >> rook_shift[sq];
-    return rook_moves_table[sq][index];
+    return tables.rook[rook_offset[sq] + index];
 }
 
 // Keep relevant blockers, hash the subset, then index sq's slice.
 inline Bitboard bishop_moves(Square sq, Bitboard occupied) {
     const Bitboard      occ   = occupied & bishop_mask[sq];
     const std::uint64_t index = (occ * bishop_magic[sq]) >> bishop_shift[sq];
-    return bishop_moves_table[sq][index];
+    return tables.bishop[bishop_offset[sq] + index];
 }
 
 // Queen slider attacks are the union of bishop and rook lookups.
@@ -0,0 +1,85 @@
+#include "core/attacks_pext.hpp"
+
+#if LATRUNCULI_USE_PEXT
+#include <cpuid.h>
+#endif
+
+#include "core/bitboard.hpp"
+#include "core/slider_attacks.hpp"
+
+namespace attacks::pext {
+
+namespace {
+
+#if LATRUNCULI_USE_PEXT
+bool cpu_has_bmi2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2");
+}
+
+// AMD parts before Zen 3 (family 19h) microcode PEXT, making it slower than a magic multiply.
+bool cpu_has_fast_pext() {
+    if (!cpu_has_bmi2())
+        return false;
+    if (!__builtin_cpu_is("amd"))
+        return true;
+
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return false;
+
+    unsigned int family = (eax >> 8) & 0xF;
+    if (family == 0xF)
+        family += (eax >> 20) & 0xFF;
+    return family >= 0x19;
+}
+#else
+bool cpu_has_bmi2() {
+    return false;
+}
+
+bool cpu_has_fast_pext() {
+    return false;
+}
+#endif
+
+// Fill each square's slice with attacks for its blocker subsets, in PEXT order. Writing past
+// the end of the table fails compilation.
+consteval void fill_slider_table(const slider::Rays& rays,
+                                 PieceType           slider,
+                                 SliderEntry         entries[64],
+                                 Bitboard*           table) {
+    std::uint32_t offset = 0;
+
+    for (Square sq = A1; sq < INVALID; ++sq) {
+        const Bitboard mask = rays.relevant_mask(slider, sq);
+        entries[sq]         = {.mask = mask, .offset = offset};
+
+        // Carry-rippler: subsets of mask in increasing order of their extracted index.
+        Bitboard occupied = 0;
+        do {
+            table[offset++] = rays.moves(slider, sq, occupied);
+            occupied        = (occupied - mask) & mask;
+        } while (occupied);
+    }
+}
+
+consteval AttackTables make_tables() {
+    AttackTables result{};
+    if (!compiled)
+        return result;
+
+    const slider::Rays rays;
+    fill_slider_table(rays, ROOK, result.rook_entries, result.rook);
+    fill_slider_table(rays, BISHOP, result.bishop_entries, result.bishop);
+    return result;
+}
+
+} // namespace
+
+constinit const AttackTables tables = make_tables();
+
+const bool supported = cpu_has_bmi2();
+const bool enabled   = cpu_has_fast_pext();
+
+} // namespace attacks::pext
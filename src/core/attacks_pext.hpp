@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+#if LATRUNCULI_USE_PEXT && defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "core/square.hpp"
+
+namespace attacks::pext {
+
+// Whether this build carries the PEXT backend. Only x86-64 builds can.
+inline constexpr bool compiled = LATRUNCULI_USE_PEXT;
+
+// Whether the CPU has BMI2; lookups below are valid only then. Detected during static
+// initialization and false until then, which keeps earlier callers on the magic backend.
+extern const bool supported;
+
+// Whether PEXT is also fast on this CPU, selecting this backend over magics.
+extern const bool enabled;
+
+// A square's relevant blockers and the start of its slice, indexed by their PEXT.
+struct SliderEntry {
+    Bitboard      mask;
+    std::uint32_t offset;
+};
+
+// Compile-time generated tables in read-only storage; each slice holds 2^N attacks for N
+// relevant blockers.
+struct AttackTables {
+    SliderEntry rook_entries[64];
+    SliderEntry bishop_entries[64];
+    Bitboard    rook[102400];
+    Bitboard    bishop[5248];
+};
+
+extern const AttackTables tables;
+
+// Gathers the occupied bits under mask into the low bits of the result.
+inline std::uint64_t extract(Bitboard occupied, Bitboard mask) {
+#if LATRUNCULI_USE_PEXT && defined(__BMI2__)
+    return _pext_u64(occupied, mask);
+#elif LATRUNCULI_USE_PEXT
+    // Inline assembly keeps the rest of the build free of BMI2 code; `enabled` gates every use.
+    std::uint64_t index;
+    asm("pextq %2, %1, %0" : "=r"(index) : "r"(occupied), "r"(mask));
+    return index;
+#else
+    (void)occupied;
+    (void)mask;
+    return 0;
+#endif
+}
+
+inline Bitboard rook_moves(Square sq, Bitboard occupied) {
+    const SliderEntry& entry = tables.rook_entries[sq];
+    return tables.rook[entry.offset + extract(occupied, entry.mask)];
+}
+
+inline Bitboard bishop_moves(Square sq, Bitboard occupied) {
+    const SliderEntry& entry = tables.bishop_entries[sq];
+    return tables.bishop[entry.offset + extract(occupied, entry.mask)];
+}
+
+} // namespace attacks::pext
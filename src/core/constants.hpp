@@ -17,6 +17,14 @@ constexpr const char* version = LATRUNCULI_VERSION;
 // Default transposition-table capacity advertised through UCI, in megabytes.
 constexpr int default_hash_mb = 32;
 
+// Largest transposition-table capacity accepted through UCI (1 TB), in megabytes.
+constexpr int max_hash_mb = 1 << 20;
+
+// Default and largest subtree-count table for the console perft command, in megabytes. Kept
+// apart from Hash so perft does not allocate a second search-sized table.
+constexpr int default_perft_hash_mb = 16;
+constexpr int max_perft_hash_mb     = 1 << 10;
+
 // Search-depth bounds used for fixed-size stacks and mate-distance margins.
 constexpr int max_search_depth = 64;
 constexpr int max_search_ply   = 2 * max_search_depth;
@@ -32,4 +40,7 @@ constexpr EvalValue mate          = inf - 1;
 constexpr EvalValue mate_bound    = mate - engine::max_search_ply;
 constexpr EvalValue tt_mate_bound = mate - 2 * engine::max_search_ply;
 
+// Marker for an absent evaluation; below every reachable score and still int16-representable.
+constexpr EvalValue none = -inf - 1;
+
 } // namespace eval_value
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "core/bitboard.hpp"
+#include "core/piece.hpp"
+#include "core/square.hpp"
+
+// Compile-time slider attack generation shared by the magic and PEXT table builders. Only the
+// consteval table constructors use it; runtime lookups go through the finished tables.
+namespace attacks::slider {
+
+// Rays from each square to the board edge. Even directions are orthogonal and odd ones diagonal:
+// north, north-east, east, south-east, south, south-west, west, north-west.
+struct Rays {
+    static constexpr int file_delta[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    static constexpr int rank_delta[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+
+    consteval Rays() noexcept {
+        for (Square sq = A1; sq < INVALID; ++sq) {
+            for (int dir = 0; dir < 8; ++dir) {
+                int file = square::file_of(sq) + file_delta[dir];
+                int rank = square::rank_of(sq) + rank_delta[dir];
+                while (0 <= file && file < 8 && 0 <= rank && rank < 8) {
+                    bb::add(ray[sq][dir], square::make(File(file), Rank(rank)));
+                    file += file_delta[dir];
+                    rank += rank_delta[dir];
+                }
+            }
+        }
+    }
+
+    // Rays toward higher squares meet their nearest square at the least significant bit.
+    static constexpr bool ascending(int dir) noexcept {
+        return rank_delta[dir] * 8 + file_delta[dir] > 0;
+    }
+
+    // Attacks along the slider's rays, each stopping at and including its nearest blocker.
+    constexpr Bitboard moves(PieceType slider, Square sq, Bitboard occupied) const noexcept {
+        Bitboard attacks = 0;
+        for (int dir = slider == ROOK ? 0 : 1; dir < 8; dir += 2) {
+            Bitboard       squares  = ray[sq][dir];
+            const Bitboard blockers = squares & occupied;
+            if (blockers)
+                squares ^= ray[ascending(dir) ? bb::lsb(blockers) : bb::msb(blockers)][dir];
+            attacks |= squares;
+        }
+        return attacks;
+    }
+
+    // Squares whose occupancy can change the attacks: each ray without its edge square, which
+    // is attacked whether or not it is occupied.
+    constexpr Bitboard relevant_mask(PieceType slider, Square sq) const noexcept {
+        Bitboard mask = 0;
+        for (int dir = slider == ROOK ? 0 : 1; dir < 8; dir += 2) {
+            Bitboard squares = ray[sq][dir];
+            if (squares)
+                squares ^= bb::set(ascending(dir) ? bb::msb(squares) : bb::lsb(squares));
+            mask |= squares;
+        }
+        return mask;
+    }
+
+    Bitboard ray[N_SQUARES][8]{};
+};
+
+} // namespace attacks::slider
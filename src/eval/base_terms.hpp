@@ -16,17 +16,19 @@ public:
         return piece_square_score;
     }
 
-    constexpr void add_piece(PieceType piece_type, Color color, Square square) noexcept {
+    LATRUNCULI_EVAL_FN void add_piece(PieceType piece_type, Color color, Square square) noexcept {
         material_score += eval::piece(piece_type, color);
         piece_square_score += eval::piece_sq(piece_type, color, square);
     }
 
-    constexpr void remove_piece(PieceType piece_type, Color color, Square square) noexcept {
+    LATRUNCULI_EVAL_FN void
+    remove_piece(PieceType piece_type, Color color, Square square) noexcept {
         material_score -= eval::piece(piece_type, color);
         piece_square_score -= eval::piece_sq(piece_type, color, square);
     }
 
-    constexpr void move_piece(PieceType piece_type, Color color, Square from, Square to) noexcept {
+    LATRUNCULI_EVAL_FN void
+    move_piece(PieceType piece_type, Color color, Square from, Square to) noexcept {
         piece_square_score +=
             eval::piece_sq(piece_type, color, to) - eval::piece_sq(piece_type, color, from);
     }
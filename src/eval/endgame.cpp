@@ -0,0 +1,219 @@
+#include "eval/endgame.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "board/board.hpp"
+#include "core/attacks.hpp"
+#include "core/constants.hpp"
+#include "eval/parameters.hpp"
+
+namespace eval::endgame {
+
+namespace {
+
+// Known wins stay below the TT's mate band so stored scores are never mistaken for mates.
+constexpr EvalValue win_limit = eval_value::tt_mate_bound - 1;
+
+// Larger toward the edge: zero in the centre and 120 in a corner.
+constexpr int push_to_edge(Square square) {
+    const int file = square::file_of(square);
+    const int rank = square::rank_of(square);
+    return 20 * (6 - std::min(file, 7 - file) - std::min(rank, 7 - rank));
+}
+
+// Larger when the kings are close: 120 when adjacent.
+constexpr int push_close(Square square1, Square square2) {
+    return 140 - 20 * square::distance(square1, square2);
+}
+
+// Zero on the a8-h1 diagonal and 7 in the a1 and h8 corners.
+constexpr int push_to_corner(Square square) {
+    return std::abs(7 - square::rank_of(square) - square::file_of(square));
+}
+
+template <Color C>
+Bitboard passed_pawns(const Board& board) {
+    return board.pieces<PAWN>(C) & ~bb::full_span<~C>(board.pieces<PAWN>(~C));
+}
+
+// KPK positions: white king, black king, side to move, pawn file A-D and pawn rank 2-7.
+constexpr int kpk_size = N_SQUARES * N_SQUARES * N_COLORS * 4 * 6;
+
+enum KPKResult : std::uint8_t { KPKInvalid = 0, KPKUnknown = 1, KPKDraw = 2, KPKWin = 4 };
+
+struct KPKPosition {
+    Color  side_to_move;
+    Square white_king;
+    Square black_king;
+    Square pawn;
+};
+
+constexpr int kpk_index(Color side_to_move, Square white_king, Square pawn, Square black_king) {
+    return white_king | (black_king << 6) | (side_to_move << 12) | (square::file_of(pawn) << 13)
+         | ((square::rank_of(pawn) - RANK2) << 15);
+}
+
+constexpr KPKPosition kpk_position(int index) {
+    return {Color((index >> 12) & 1),
+            Square(index & 63),
+            Square((index >> 6) & 63),
+            square::make(File((index >> 13) & 3), Rank(RANK2 + (index >> 15)))};
+}
+
+// Classification that needs no successor: illegal, immediate promotion, stalemate, or a lost
+// pawn. Everything else starts unknown.
+KPKResult kpk_initial_result(const KPKPosition& pos) {
+    const Bitboard pawn_attacks = attacks::pawn_attacks<WHITE>(pos.pawn);
+    const Bitboard white_moves  = attacks::piece_moves<KING>(pos.white_king);
+    const Bitboard black_moves  = attacks::piece_moves<KING>(pos.black_king);
+
+    if (square::distance(pos.white_king, pos.black_king) <= 1 || pos.white_king == pos.pawn
+        || pos.black_king == pos.pawn
+        || (pos.side_to_move == WHITE && bb::contains(pawn_attacks, pos.black_king)))
+        return KPKInvalid;
+
+    const Square promotion = pos.pawn + square::north;
+    if (pos.side_to_move == WHITE && square::rank_of(pos.pawn) == RANK7
+        && pos.white_king != promotion && pos.black_king != promotion
+        && (square::distance(pos.black_king, promotion) > 1
+            || square::distance(pos.white_king, promotion) == 1))
+        return KPKWin;
+
+    if (pos.side_to_move == BLACK
+        && (!(black_moves & ~(white_moves | pawn_attacks))
+            || (black_moves & ~white_moves & bb::set(pos.pawn))))
+        return KPKDraw;
+
+    return KPKUnknown;
+}
+
+// White wins if any move wins; Black draws if any move draws.
+KPKResult kpk_classify(const std::vector<KPKResult>& results, const KPKPosition& pos) {
+    const bool      white = pos.side_to_move == WHITE;
+    const KPKResult good  = white ? KPKWin : KPKDraw;
+    const KPKResult bad   = white ? KPKDraw : KPKWin;
+
+    int reachable = KPKInvalid;
+    Bitboard king_moves = attacks::piece_moves<KING>(white ? pos.white_king : pos.black_king);
+    while (king_moves) {
+        const Square to = bb::lsb_pop(king_moves);
+        reachable |= white ? results[kpk_index(BLACK, to, pos.pawn, pos.black_king)]
+                           : results[kpk_index(WHITE, pos.white_king, pos.pawn, to)];
+    }
+
+    if (white && square::rank_of(pos.pawn) < RANK7) {
+        const Square push = pos.pawn + square::north;
+        reachable |= results[kpk_index(BLACK, pos.white_king, push, pos.black_king)];
+
+        const Square double_push = push + square::north;
+        if (square::rank_of(pos.pawn) == RANK2 && push != pos.white_king
+            && push != pos.black_king)
+            reachable |= results[kpk_index(BLACK, pos.white_king, double_push, pos.black_king)];
+    }
+
+    if (reachable & good)
+        return good;
+    return (reachable & KPKUnknown) ? KPKUnknown : bad;
+}
+
+// Retrograde fixed point over all KPK positions; positions never resolved are draws.
+std::bitset<kpk_size> build_kpk_bitbase() {
+    std::vector<KPKResult> results(kpk_size);
+    for (int index = 0; index < kpk_size; ++index)
+        results[index] = kpk_initial_result(kpk_position(index));
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (int index = 0; index < kpk_size; ++index) {
+            if (results[index] != KPKUnknown)
+                continue;
+            results[index] = kpk_classify(results, kpk_position(index));
+            changed |= results[index] != KPKUnknown;
+        }
+    }
+
+    std::bitset<kpk_size> wins;
+    for (int index = 0; index < kpk_size; ++index)
+        wins[index] = results[index] == KPKWin;
+    return wins;
+}
+
+} // namespace
+
+bool kpk_win(Color side_to_move, Square white_king, Square pawn, Square black_king) {
+    static const std::bitset<kpk_size> wins = build_kpk_bitbase();
+
+    // The bitbase stores pawns on files A-D; mirror the rest horizontally.
+    if (square::file_of(pawn) > FILE4) {
+        white_king = Square(white_king ^ 7);
+        pawn       = Square(pawn ^ 7);
+        black_king = Square(black_king ^ 7);
+    }
+    return wins[kpk_index(side_to_move, white_king, pawn, black_king)];
+}
+
+EvalValue draw(const Board&, Color) {
+    return eval_value::draw;
+}
+
+EvalValue kxk(const Board& board, Color strong_side) {
+    const Square strong_king = board.king_sq(strong_side);
+    const Square weak_king   = board.king_sq(~strong_side);
+
+    EvalValue result = board.non_pawn_material(strong_side)
+                     + board.count(strong_side, PAWN) * eval::pawn.eg() + push_to_edge(weak_king)
+                     + push_close(strong_king, weak_king);
+
+    const Bitboard bishops = board.pieces<BISHOP>(strong_side);
+    if (board.count(strong_side, QUEEN) || board.count(strong_side, ROOK)
+        || (board.count(strong_side, BISHOP) && board.count(strong_side, KNIGHT))
+        || ((bishops & masks::dark_squares) && (bishops & masks::light_squares)))
+        result = std::min(result + known_win, win_limit);
+
+    return strong_side == WHITE ? result : -result;
+}
+
+EvalValue kbnk(const Board& board, Color strong_side) {
+    const Square strong_king = board.king_sq(strong_side);
+    const Square weak_king   = board.king_sq(~strong_side);
+    const Square bishop      = bb::lsb(board.pieces<BISHOP>(strong_side));
+
+    // push_to_corner favours the dark a1 and h8 corners; mirror for a light-squared bishop.
+    const Square corner_target =
+        bb::contains(masks::dark_squares, bishop) ? weak_king : Square(weak_king ^ 7);
+    const EvalValue result =
+        known_win + push_close(strong_king, weak_king) + 60 * push_to_corner(corner_target);
+
+    return strong_side == WHITE ? result : -result;
+}
+
+EvalValue kpk(const Board& board, Color strong_side) {
+    // Normalise so the stronger side plays White.
+    const Square strong_pawn  = bb::lsb(board.pieces<PAWN>(strong_side));
+    const Square strong_king  = square::relative(board.king_sq(strong_side), strong_side);
+    const Square weak_king    = square::relative(board.king_sq(~strong_side), strong_side);
+    const Square pawn         = square::relative(strong_pawn, strong_side);
+    const Color  side_to_move = board.side_to_move() == strong_side ? WHITE : BLACK;
+
+    if (!kpk_win(side_to_move, strong_king, pawn, weak_king))
+        return eval_value::draw;
+
+    const EvalValue result = known_win + eval::pawn.eg() + 16 * square::rank_of(pawn);
+    return strong_side == WHITE ? result : -result;
+}
+
+int opposite_bishops(const Board& board, Color strong_side) {
+    const Bitboard bishops = board.pieces<BISHOP>();
+    if (!(bishops & masks::dark_squares) || !(bishops & masks::light_squares))
+        return no_scale;
+
+    const Bitboard passed =
+        strong_side == WHITE ? passed_pawns<WHITE>(board) : passed_pawns<BLACK>(board);
+    return std::min(eval::scale_limit, 16 + 8 * bb::count(passed));
+}
+
+} // namespace eval::endgame
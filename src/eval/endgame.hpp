@@ -0,0 +1,48 @@
+#pragma once
+
+#include "core/square.hpp"
+#include "core/types.hpp"
+
+class Board;
+
+namespace eval {
+
+// Specialised evaluation for a known material signature. Returns a White-relative value
+// that replaces the full evaluator's tapered score.
+using EndgameEval = EvalValue (*)(const Board& board, Color strong_side);
+
+// Specialised endgame scale factor over scale_limit for strong_side, or no_scale to keep the
+// material entry's default.
+using EndgameScale = int (*)(const Board& board, Color strong_side);
+
+namespace endgame {
+
+inline constexpr int no_scale = -1;
+
+// Base value for material configurations that are won with correct technique; stays well
+// below the mate guard bands.
+inline constexpr EvalValue known_win = 10000;
+
+// Draw by insufficient material: neither side can force mate.
+[[nodiscard]] EvalValue draw(const Board& board, Color strong_side);
+
+// Mating material against a bare king: drive the defending king to the edge.
+[[nodiscard]] EvalValue kxk(const Board& board, Color strong_side);
+
+// Bishop and knight against a bare king: drive it to a corner of the bishop's colour.
+[[nodiscard]] EvalValue kbnk(const Board& board, Color strong_side);
+
+// King and pawn against a bare king, resolved exactly by the KPK bitbase.
+[[nodiscard]] EvalValue kpk(const Board& board, Color strong_side);
+
+// Bishops on opposite colours with no other pieces: scale toward a draw unless the stronger
+// side has several passed pawns.
+[[nodiscard]] int opposite_bishops(const Board& board, Color strong_side);
+
+// KPK bitbase probe from White's perspective: White has the king and pawn. True when White
+// wins with side_to_move to move.
+[[nodiscard]] bool kpk_win(Color side_to_move, Square white_king, Square pawn, Square black_king);
+
+} // namespace endgame
+
+} // namespace eval
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "core/constants.hpp"
+#include "core/types.hpp"
+
+namespace eval {
+
+// Static evaluation for one full position key; value is eval_value::none when empty.
+struct EvalCacheEntry {
+    PositionKey key   = 0;
+    EvalValue   value = eval_value::none;
+};
+
+// Direct-mapped cache of final static evaluations owned by one search worker. Re-searches
+// and transpositions revisit the same positions, so a hit skips the evaluator entirely.
+// Entries are exact for their key and never need clearing between searches.
+class EvalCache {
+public:
+    static constexpr std::size_t size = std::size_t{1} << 16;
+
+    EvalCache() : entries(size) {}
+
+    [[nodiscard]] EvalCacheEntry& operator[](PositionKey key) noexcept {
+        return entries[key & (size - 1)];
+    }
+
+    void clear() { entries.assign(size, EvalCacheEntry{}); }
+
+private:
+    std::vector<EvalCacheEntry> entries;
+};
+
+} // namespace eval
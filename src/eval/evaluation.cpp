@@ -1,19 +1,58 @@
 #include "eval/evaluator.hpp"
 
-#include <algorithm>
-
 #include "board/board.hpp"
+#include "eval/eval_cache.hpp"
 #include "eval/parameters.hpp"
 
 namespace eval {
 
-Evaluator::Evaluator(const Board& board) : board{board} {
+namespace {
+
+EvalValue taper(TaperedScore score, int mg_phase) {
+    const int eg_phase = eval::phase_limit - mg_phase;
+    return ((score.mg() * mg_phase) + (score.eg() * eg_phase)) / eval::phase_limit;
+}
+
+// Mirrors Evaluator::evaluate_impl with every term beyond material and PSQT left out.
+EvalValue base_value(const Board& board, const MaterialEntry& material_entry) {
+    TaperedScore score = board.base_terms().material() + board.base_terms().piece_square();
+
+    const Color stronger_side = score.eg() < 0 ? BLACK : WHITE;
+    score = {score.mg(), (score.eg() * material_entry.scale[stronger_side]) / eval::scale_limit};
+
+    const EvalValue tapered_value = taper(score, material_entry.phase);
+    return tapered_value * (board.side_to_move() == WHITE ? 1 : -1) + eval::tempo_bonus;
+}
+
+} // namespace
+
+Evaluator::Evaluator(const Board& board, PawnTable* pawn_table, MaterialTable* material_table)
+    : board{board},
+      pawn_entry{pawn_table ? &(*pawn_table)[board.pawn_key()] : &local_pawn_entry},
+      material_entry{material_table ? &material_table->probe(board) : &local_material_entry} {
+    if (!material_table)
+        local_material_entry = MaterialTable::analyse(board);
+
+    if (!pawn_table || pawn_entry->key != board.pawn_key()) {
+        *pawn_entry     = PawnEntry{};
+        pawn_entry->key = board.pawn_key();
+        compute_pawn_entry<false, WHITE>(*pawn_entry);
+        compute_pawn_entry<false, BLACK>(*pawn_entry);
+    }
+
     initialize<WHITE>();
     initialize<BLACK>();
 }
 
 template <bool Tracing>
 EvalValue Evaluator::evaluate_impl(Trace* trace) {
+    // Known endgames replace the term sum; traces still record the terms for diagnosis.
+    const EndgameEval endgame = material_entry->evaluation;
+    if (!Tracing && endgame) {
+        const EvalValue value = endgame(board, material_entry->strong_side);
+        return finish<Tracing>(trace, TaperedScore::Zero, TaperedScore::Zero, value);
+    }
+
     TaperedScore score;
 
     // Basic terms.
@@ -38,18 +77,36 @@ EvalValue Evaluator::evaluate_impl(Trace* trace) {
     score += evaluate_term<Tracing, Term::Threats, WHITE>(trace)
            - evaluate_term<Tracing, Term::Threats, BLACK>(trace);
 
-    const Color        side_to_move   = board.side_to_move();
-    const Color        stronger_side  = score.eg < 0 ? BLACK : WHITE;
+    if (endgame)
+        return finish<Tracing>(trace, score, score, endgame(board, material_entry->strong_side));
+
+    if constexpr (Tracing)
+        trace->record_scaling(phase(), scale_factor(WHITE), scale_factor(BLACK));
+
+    const Color        stronger_side  = score.eg() < 0 ? BLACK : WHITE;
     const TaperedScore unscaled_score = score;
-    score.eg = (score.eg * scale_factor(stronger_side)) / eval::scale_limit;
+    score = {score.mg(), (score.eg() * scale_factor(stronger_side)) / eval::scale_limit};
+
+    return finish<Tracing>(trace, unscaled_score, score, taper_score(score));
+}
 
-    const EvalValue tapered_value      = taper_score(score);
+// Convert a White-relative tapered value to the side-to-move result.
+template <bool Tracing>
+EvalValue Evaluator::finish(Trace*       trace,
+                            TaperedScore unscaled_score,
+                            TaperedScore scaled_score,
+                            EvalValue    tapered_value) {
+    const Color     side_to_move       = board.side_to_move();
     const EvalValue side_to_move_value = tapered_value * (side_to_move == WHITE ? 1 : -1);
     const EvalValue final_value        = side_to_move_value + eval::tempo_bonus;
 
     if constexpr (Tracing) {
-        trace->complete(
-            unscaled_score, score, tapered_value, side_to_move_value, final_value, side_to_move);
+        trace->complete(unscaled_score,
+                        scaled_score,
+                        tapered_value,
+                        side_to_move_value,
+                        final_value,
+                        side_to_move);
     }
 
     return final_value;
@@ -61,37 +118,87 @@ EvalValue Evaluator::evaluate() {
 
 Trace Evaluator::trace() {
     Trace result;
+
+    // The constructor filled the pawn entry before tracing began; refill it so the pawn terms
+    // record their coefficients too.
+    coefficient_trace = &result;
+    compute_pawn_entry<true, WHITE>(*pawn_entry);
+    compute_pawn_entry<true, BLACK>(*pawn_entry);
+
     evaluate_impl<true>(&result);
     return result;
 }
 
-// Integer numerator for scaling endgame evaluation toward zero in drawish pawn endings.
+// Integer numerator for scaling endgame evaluation toward zero in drawish endings.
 int Evaluator::scale_factor(Color color) const {
-    const int pawn_count = board.count(color, PAWN);
-    return std::min(eval::scale_limit, eval::scale_base + eval::scale_per_pawn * pawn_count);
+    if (material_entry->scaling) {
+        const int scale = material_entry->scaling(board, color);
+        if (scale != endgame::no_scale)
+            return scale;
+    }
+    return material_entry->scale[color];
 }
 
 // Blend middlegame and endgame scores based on game phase.
 EvalValue Evaluator::taper_score(TaperedScore score) const {
-    const int mg_phase = phase();
-    const int eg_phase = eval::phase_limit - mg_phase;
-
-    return ((score.mg * mg_phase) + (score.eg * eg_phase)) / eval::phase_limit;
+    return taper(score, phase());
 }
 
 // Game phase: zero is endgame and phase_limit is middlegame.
 int Evaluator::phase() const {
-    const int non_pawn_material = board.non_pawn_material(WHITE) + board.non_pawn_material(BLACK);
-    const int material = std::clamp(non_pawn_material, eval::material_eg, eval::material_mg);
-
-    return ((material - eval::material_eg) * eval::phase_limit)
-         / (eval::material_mg - eval::material_eg);
+    return material_entry->phase;
 }
 
 EvalValue evaluate(const Board& board) {
     return Evaluator(board).evaluate();
 }
 
+EvalValue evaluate(const Board& board, PawnTable& pawn_table, MaterialTable& material_table) {
+    return Evaluator(board, &pawn_table, &material_table).evaluate();
+}
+
+CachedEvaluation evaluate_cached(const Board&   board,
+                                 EvalCache&     eval_cache,
+                                 PawnTable&     pawn_table,
+                                 MaterialTable& material_table) {
+    EvalCacheEntry& entry = eval_cache[board.key()];
+    if (entry.key == board.key() && entry.value != eval_value::none)
+        return {entry.value, true};
+
+    entry.key   = board.key();
+    entry.value = evaluate(board, pawn_table, material_table);
+    return {entry.value, false};
+}
+
+CachedEvaluation evaluate_lazy(const Board&   board,
+                               EvalValue      alpha,
+                               EvalValue      beta,
+                               EvalCache&     eval_cache,
+                               PawnTable&     pawn_table,
+                               MaterialTable& material_table) {
+    EvalCacheEntry& entry = eval_cache[board.key()];
+    if (entry.key == board.key() && entry.value != eval_value::none)
+        return {entry.value, true};
+
+    // Known endgames and scaling functions can move the value arbitrarily far from material.
+    const MaterialEntry& material_entry = material_table.probe(board);
+    if (!material_entry.evaluation && !material_entry.scaling) {
+        const EvalValue base = base_value(board, material_entry);
+        if (base + eval::lazy_margin <= alpha)
+            return {base + eval::lazy_margin, false, false};
+        if (base - eval::lazy_margin >= beta)
+            return {base - eval::lazy_margin, false, false};
+    }
+
+    entry.key   = board.key();
+    entry.value = evaluate(board, pawn_table, material_table);
+    return {entry.value, false};
+}
+
+EvalValue evaluate_base(const Board& board) {
+    return base_value(board, MaterialTable::analyse(board));
+}
+
 Trace evaluate_trace(const Board& board) {
     return Evaluator(board).trace();
 }
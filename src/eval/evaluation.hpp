@@ -7,7 +7,40 @@ class Board;
 
 namespace eval {
 
+class EvalCache;
+class MaterialTable;
+class PawnTable;
+
+// Result of evaluate_cached; hit reports whether the evaluator was skipped. An inexact value
+// is an estimate from evaluate_lazy that still lies outside the caller's window.
+struct CachedEvaluation {
+    EvalValue value;
+    bool      hit;
+    bool      exact = true;
+};
+
 [[nodiscard]] EvalValue evaluate(const Board& board);
+// Same value as evaluate(board), reusing pawn-structure and material terms cached in the
+// caller's tables.
+[[nodiscard]] EvalValue
+evaluate(const Board& board, PawnTable& pawn_table, MaterialTable& material_table);
+// Same value again, first consulting eval_cache by the full position key.
+[[nodiscard]] CachedEvaluation evaluate_cached(const Board&   board,
+                                               EvalCache&     eval_cache,
+                                               PawnTable&     pawn_table,
+                                               MaterialTable& material_table);
+// Same value again, unless on a cache miss the material and PSQT estimate lies more than
+// lazy_margin outside [alpha, beta]. The estimate widened by lazy_margin toward the window is
+// then returned inexact and not cached. The margin is a heuristic, not a proven bound: a
+// positional swing larger than lazy_margin, such as extreme king danger, makes it wrong.
+[[nodiscard]] CachedEvaluation evaluate_lazy(const Board&   board,
+                                             EvalValue      alpha,
+                                             EvalValue      beta,
+                                             EvalCache&     eval_cache,
+                                             PawnTable&     pawn_table,
+                                             MaterialTable& material_table);
+// Material and PSQT alone, scaled, tapered and returned from the side to move's perspective.
+[[nodiscard]] EvalValue evaluate_base(const Board& board);
 [[nodiscard]] Trace     evaluate_trace(const Board& board);
 
 } // namespace eval
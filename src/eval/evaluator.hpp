@@ -3,6 +3,8 @@
 #include "core/piece.hpp"
 #include "core/square.hpp"
 #include "eval/evaluation.hpp"
+#include "eval/material_table.hpp"
+#include "eval/pawn_table.hpp"
 #include "eval/tapered_score.hpp"
 
 class Board;
@@ -14,7 +16,9 @@ namespace eval {
 class Evaluator {
 private:
     Evaluator() = delete;
-    explicit Evaluator(const Board&);
+    explicit Evaluator(const Board&,
+                       PawnTable*     pawn_table     = nullptr,
+                       MaterialTable* material_table = nullptr);
     Evaluator(const Evaluator&)            = delete;
     Evaluator& operator=(const Evaluator&) = delete;
     Evaluator(Evaluator&&)                 = delete;
@@ -25,6 +29,18 @@ private:
 
     const Board& board;
 
+    // Pawn terms come from pawn_entry: a probed PawnTable slot, or local_pawn_entry when
+    // evaluating without a table.
+    PawnEntry  local_pawn_entry;
+    PawnEntry* pawn_entry;
+
+    // Phase, scale factors and known endgames for this material, probed or analysed locally.
+    MaterialEntry  local_material_entry;
+    MaterialEntry* material_entry;
+
+    // Set while tracing; count<true, C> records each tunable weight's uses into it.
+    Trace* coefficient_trace = nullptr;
+
     struct AttackData {
         Bitboard by[N_COLORS][N_PIECETYPES] = {{0}};
         Bitboard by2[N_COLORS]              = {0};
@@ -57,11 +73,14 @@ private:
     template <Color C>
     void initialize();
 
+    template <bool Tracing, Color C>
+    void count(std::size_t parameter, int uses = 1) const;
+
     template <Color C>
-    Bitboard outposts_zone(Bitboard pawns, Bitboard opp_pawns) const;
+    Bitboard outposts_zone(Bitboard pawn_attacks, Bitboard opp_attack_span) const;
 
     template <Color C>
-    Bitboard mobility_zone(Bitboard pawns, Bitboard opp_pawns, Square king_sq) const;
+    Bitboard mobility_zone(Bitboard pawns, Bitboard opp_pawn_attacks, Square king_sq) const;
 
     template <Color C>
     Bitboard king_zone(Square king_sq) const;
@@ -69,55 +88,61 @@ private:
     template <bool Tracing>
     EvalValue evaluate_impl(Trace* trace);
 
+    template <bool Tracing>
+    EvalValue finish(Trace* trace, TaperedScore unscaled, TaperedScore scaled, EvalValue tapered);
+
     template <bool Tracing, Term term, Color C = WHITE>
     TaperedScore evaluate_term(Trace* trace);
 
+    template <bool Tracing, Color C>
+    void compute_pawn_entry(PawnEntry& entry) const;
+
     template <Color C>
     TaperedScore evaluate_pawns();
 
-    template <Color C, PieceType P>
+    template <bool Tracing, Color C, PieceType P>
     TaperedScore evaluate_pieces();
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_king_safety() const;
 
     template <Color C, PieceType P>
     void update_attacks(Bitboard moves);
 
-    template <Color C, PieceType P>
+    template <bool Tracing, Color C, PieceType P>
     void update_mobility(Bitboard moves);
 
-    template <Color C, PieceType P>
+    template <bool Tracing, Color C, PieceType P>
     void update_threats(const PieceContext& context);
 
-    template <Color C, PieceType P>
+    template <bool Tracing, Color C, PieceType P>
     TaperedScore update_attackers(const PieceContext& context, Bitboard moves);
 
     template <Color C, PieceType P>
     Bitboard get_moves(const PieceContext& context) const;
 
-    template <Color C, PieceType P>
+    template <bool Tracing, Color C, PieceType P>
     TaperedScore evaluate_minor_pieces(const PieceContext& context, Bitboard moves) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_bishops(const PieceContext& context) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_bishop_blockers(const PieceContext& context) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_rook(const PieceContext& context) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_queen(const PieceContext& context) const;
 
     template <Color C, PieceType P>
     bool discovery_attack(const PieceContext& context) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_shelter(Square king_sq) const;
 
-    template <Color C>
+    template <bool Tracing, Color C>
     TaperedScore evaluate_shelter_file(Bitboard pawns, Bitboard opp_pawns, File file) const;
 
     template <Color C>
@@ -134,6 +159,7 @@ private:
     int       phase() const;
 
     friend EvalValue evaluate(const Board& board);
+    friend EvalValue evaluate(const Board&, PawnTable&, MaterialTable&);
     friend Trace     evaluate_trace(const Board& board);
     friend class ::EvaluatorTestAccess;
 };
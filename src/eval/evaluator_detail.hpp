@@ -1,10 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
 #include "board/board.hpp"
 #include "core/attacks.hpp"
 #include "core/constants.hpp"
 #include "eval/evaluator.hpp"
+#include "eval/parameter_vector.hpp"
 #include "eval/parameters.hpp"
+#include "eval/profile.hpp"
 
 namespace eval {
 
@@ -17,35 +23,40 @@ inline void Evaluator::initialize() {
     const Bitboard king_moves = attacks::piece_moves<KING>(king_sq);
     update_attacks<C, KING>(king_moves);
 
-    const Bitboard pawns     = board.pieces<PAWN>(C);
-    const Bitboard opp_pawns = board.pieces<PAWN>(Opp);
+    const Bitboard pawns            = board.pieces<PAWN>(C);
+    const Bitboard pawn_attacks     = pawn_entry->pawn_attacks[C];
+    const Bitboard opp_pawn_attacks = pawn_entry->pawn_attacks[Opp];
+    const Bitboard opp_attack_span  = pawn_entry->attack_span[Opp];
 
-    zones.outposts[C] = outposts_zone<C>(pawns, opp_pawns);
-    zones.mobility[C] = mobility_zone<C>(pawns, opp_pawns, king_sq);
+    zones.outposts[C] = outposts_zone<C>(pawn_attacks, opp_attack_span);
+    zones.mobility[C] = mobility_zone<C>(pawns, opp_pawn_attacks, king_sq);
     zones.king[C]     = king_zone<C>(king_sq);
 }
 
+/// record uses of a tunable weight while tracing; compiled out otherwise
+template <bool Tracing, Color C>
+inline void Evaluator::count(const std::size_t parameter, const int uses) const {
+    if constexpr (Tracing)
+        coefficient_trace->add_coefficient(parameter, C == WHITE ? uses : -uses);
+}
+
 /// outposts mask: behind enemy pawns, supported by friendly pawns, on ranks 4-6
 template <Color C>
-inline Bitboard Evaluator::outposts_zone(const Bitboard pawns, const Bitboard opp_pawns) const {
-    constexpr Color Opp = ~C;
-
-    const Bitboard behind_pawns = ~bb::attack_span<Opp>(opp_pawns);
-    const Bitboard supported    = attacks::pawn_attacks<C>(pawns);
+inline Bitboard Evaluator::outposts_zone(const Bitboard pawn_attacks,
+                                         const Bitboard opp_attack_span) const {
+    const Bitboard behind_pawns = ~opp_attack_span;
     constexpr auto outpost_mask = (C == WHITE) ? eval::masks::w_outposts : eval::masks::b_outposts;
-    return (behind_pawns & supported & outpost_mask);
+    return (behind_pawns & pawn_attacks & outpost_mask);
 }
 
 /// mobility mask: safe from enemy pawns, not occupied by the king or rank 2 pawns
 template <Color C>
 inline Bitboard Evaluator::mobility_zone(const Bitboard pawns,
-                                         const Bitboard opp_pawns,
+                                         const Bitboard opp_pawn_attacks,
                                          const Square   king_sq) const {
-    constexpr Color Opp = ~C;
-
     constexpr auto home_pawn_rank = bb::relative_rank<C>(RANK2);
     const Bitboard occupied       = bb::set(king_sq) | (pawns & home_pawn_rank);
-    const Bitboard safe           = ~attacks::pawn_attacks<Opp>(opp_pawns);
+    const Bitboard safe           = ~opp_pawn_attacks;
     return (safe & ~occupied);
 }
 
@@ -62,31 +73,72 @@ inline Bitboard Evaluator::king_zone(const Square king_sq) const {
 /// dispatch a single eval term -> score
 template <bool Tracing, Term term, Color C>
 inline TaperedScore Evaluator::evaluate_term(Trace* trace) {
-    TaperedScore score;
+    constexpr bool timed = profiling && !Tracing;
+
+    TaperedScore                   score;
+    [[maybe_unused]] std::uint64_t start = 0;
+    if constexpr (timed) {
+        start = profile_ticks();
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
 
     switch (term) {
     case Term::Material: score = board.base_terms().material(); break;
     case Term::Squares:  score = board.base_terms().piece_square(); break;
     case Term::Pawns:    score = evaluate_pawns<C>(); break;
-    case Term::Knights:  score = evaluate_pieces<C, KNIGHT>(); break;
-    case Term::Bishops:  score = evaluate_pieces<C, BISHOP>(); break;
-    case Term::Rooks:    score = evaluate_pieces<C, ROOK>(); break;
-    case Term::Queens:   score = evaluate_pieces<C, QUEEN>(); break;
-    case Term::King:     score = evaluate_king_safety<C>(); break;
+    case Term::Knights:  score = evaluate_pieces<Tracing, C, KNIGHT>(); break;
+    case Term::Bishops:  score = evaluate_pieces<Tracing, C, BISHOP>(); break;
+    case Term::Rooks:    score = evaluate_pieces<Tracing, C, ROOK>(); break;
+    case Term::Queens:   score = evaluate_pieces<Tracing, C, QUEEN>(); break;
+    case Term::King:     score = evaluate_king_safety<Tracing, C>(); break;
     case Term::Mobility: score = scores.mobility[C]; break;
     case Term::Threats:  score = scores.threats[C]; break;
     default:             break;
     }
 
-    if constexpr (Tracing)
+    if constexpr (timed) {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        TermProfile& profile = term_profile();
+        profile.ticks[std::to_underlying(term)] += profile_ticks() - start;
+        ++profile.calls[std::to_underlying(term)];
+    }
+
+    if constexpr (Tracing) {
         trace->record(term, C, score);
 
+        if constexpr (term == Term::Material)
+            trace->add_fixed(score);
+        if constexpr (term == Term::Squares) {
+            bb::scan<WHITE>(board.occupancy(), [&](const Square square) {
+                const Piece     piece    = board.piece_on(square);
+                const Color     color    = color_of(piece);
+                const PieceType type     = type_of(piece);
+                const Square    relative = square::relative(square, color);
+                trace->add_coefficient(parameter::psqt + piece_slot(type) * N_SQUARES + relative,
+                                       color == WHITE ? 1 : -1);
+            });
+        }
+    }
+
     return score;
 }
 
-/// eval pawn structure: isolated + backward + doubled + passed
+/// merge cached pawn attacks and return the pawn-structure score
 template <Color C>
-TaperedScore Evaluator::evaluate_pawns() {
+inline TaperedScore Evaluator::evaluate_pawns() {
+    const Bitboard pawn_attacks  = pawn_entry->pawn_attacks[C];
+    const Bitboard pawn_attacks2 = pawn_entry->pawn_attacks2[C];
+
+    attacks.by2[C] |= pawn_attacks2 | (attacks.by[C][all_pieces_slot] & pawn_attacks);
+    attacks.by[C][all_pieces_slot] |= pawn_attacks;
+    attacks.by[C][PAWN] |= pawn_attacks;
+
+    return pawn_entry->score[C];
+}
+
+/// eval pawn structure into entry: isolated + backward + doubled + passed
+template <bool Tracing, Color C>
+void Evaluator::compute_pawn_entry(PawnEntry& entry) const {
     constexpr Color Opp = ~C;
 
     const Bitboard pawns         = board.pieces<PAWN>(C);
@@ -96,15 +148,12 @@ TaperedScore Evaluator::evaluate_pawns() {
     const Bitboard pawn_attacks  = left_attacks | right_attacks;
     const Bitboard pawn_attacks2 = left_attacks & right_attacks;
 
-    attacks.by2[C] |= pawn_attacks2 | (attacks.by[C][all_pieces_slot] & pawn_attacks);
-    attacks.by[C][all_pieces_slot] |= pawn_attacks;
-    attacks.by[C][PAWN] |= pawn_attacks;
-
     // isolated pawns: no friendly pawns on adjacent files
     const Bitboard pawn_files = bb::fill(pawns);
     const Bitboard iso_pawns =
         (pawns & ~bb::shift_west(pawn_files)) & (pawns & ~bb::shift_east(pawn_files));
     TaperedScore score = eval::iso_pawn * bb::count(iso_pawns);
+    count<Tracing, C>(parameter::iso_pawn, bb::count(iso_pawns));
 
     // backwards pawns: non-isolated pawns that can't advance safely
     const Bitboard stops       = attacks::pawn_shift<pawn_delta::push, C>(pawns);
@@ -113,23 +162,30 @@ TaperedScore Evaluator::evaluate_pawns() {
     const Bitboard backwards_pawns =
         attacks::pawn_shift<pawn_delta::push, Opp>(stops & opp_attacks & ~attack_span) & ~iso_pawns;
     score += eval::backward_pawn * bb::count(backwards_pawns);
+    count<Tracing, C>(parameter::backward_pawn, bb::count(backwards_pawns));
 
     // doubled pawns: unsupported pawn with friendly pawns behind
     Bitboard pawns_behind  = pawns & bb::span_front<C>(pawns);
     Bitboard doubled_pawns = pawns_behind & ~pawn_attacks;
     score += eval::doubled_pawn * bb::count(doubled_pawns);
+    count<Tracing, C>(parameter::doubled_pawn, bb::count(doubled_pawns));
 
     // passed pawns: no opposing pawn ahead on the same or an adjacent file
     const Bitboard passed_pawns = pawns & ~bb::full_span<Opp>(opp_pawns);
     bb::scan<C>(passed_pawns, [&](const Square square) {
         score += eval::passed_pawn[square::relative_rank(square, C)];
+        count<Tracing, C>(parameter::passed_pawn + square::relative_rank(square, C));
     });
 
-    return score;
+    entry.score[C]         = score;
+    entry.pawn_attacks[C]  = pawn_attacks;
+    entry.pawn_attacks2[C] = pawn_attacks2;
+    entry.attack_span[C]   = attack_span;
+    entry.passed_pawns[C]  = passed_pawns;
 }
 
 /// eval all pieces of type p for color c
-template <Color C, PieceType P>
+template <bool Tracing, Color C, PieceType P>
 TaperedScore Evaluator::evaluate_pieces() {
     constexpr Color Opp = ~C;
 
@@ -148,54 +204,84 @@ TaperedScore Evaluator::evaluate_pieces() {
 
         const Bitboard moves = get_moves<C, P>(context);
         update_attacks<C, P>(moves);
-        update_mobility<C, P>(moves);
-        update_threats<C, P>(context);
-        score += update_attackers<C, P>(context, moves);
+        if constexpr (profiling && !Tracing) {
+            constexpr Term term = P == KNIGHT ? Term::Knights
+                                : P == BISHOP ? Term::Bishops
+                                : P == ROOK   ? Term::Rooks
+                                              : Term::Queens;
+            profile_nested<Term::Mobility, term>([&] { update_mobility<Tracing, C, P>(moves); });
+            profile_nested<Term::Threats, term>([&] { update_threats<Tracing, C, P>(context); });
+        } else {
+            update_mobility<Tracing, C, P>(moves);
+            update_threats<Tracing, C, P>(context);
+        }
+        score += update_attackers<Tracing, C, P>(context, moves);
 
         if constexpr (P == BISHOP || P == KNIGHT) {
-            score += evaluate_minor_pieces<C, P>(context, moves);
+            score += evaluate_minor_pieces<Tracing, C, P>(context, moves);
         }
 
         if constexpr (P == BISHOP) {
-            score += evaluate_bishops<C>(context);
+            score += evaluate_bishops<Tracing, C>(context);
         } else if constexpr (P == ROOK) {
-            score += evaluate_rook<C>(context);
+            score += evaluate_rook<Tracing, C>(context);
         } else if constexpr (P == QUEEN) {
-            score += evaluate_queen<C>(context);
+            score += evaluate_queen<Tracing, C>(context);
         }
     });
 
     if constexpr (P == BISHOP) {
-        if (board.count(C, BISHOP) > 1)
+        if (board.count(C, BISHOP) > 1) {
             score += eval::bishop_pair;
+            count<Tracing, C>(parameter::bishop_pair);
+        }
     }
 
     return score;
 }
 
 /// king safety: pawn shelter and king danger
-template <Color C>
+template <bool Tracing, Color C>
 TaperedScore Evaluator::evaluate_king_safety() const {
     constexpr Square kingside_sq  = C == WHITE ? G1 : G8;
     constexpr Square queenside_sq = C == WHITE ? C1 : C8;
 
-    const Square king_sq = board.king_sq(C);
-    TaperedScore shelter = evaluate_shelter<C>(king_sq);
-
-    const auto consider_shelter = [&](Square square) {
-        const TaperedScore candidate = evaluate_shelter<C>(square);
-        if (candidate.mg > shelter.mg)
-            shelter = candidate;
-    };
-
-    if (board.has_castling_right(CASTLE_KINGSIDE, C))
-        consider_shelter(kingside_sq);
-    if (board.has_castling_right(CASTLE_QUEENSIDE, C))
-        consider_shelter(queenside_sq);
+    const Square         king_sq = board.king_sq(C);
+    const CastlingRights rights  = board.castling_rights() & (C == WHITE ? W_CASTLE : B_CASTLE);
+    Square               chosen  = king_sq;
+
+    // shelter depends only on pawns, the king square and castling rights; reuse it when cached
+    if (pawn_entry->shelter_king_sq[C] != king_sq || pawn_entry->shelter_castling[C] != rights) {
+        TaperedScore shelter = evaluate_shelter<false, C>(king_sq);
+
+        const auto consider_shelter = [&](Square square) {
+            const TaperedScore candidate = evaluate_shelter<false, C>(square);
+            if (candidate.mg() > shelter.mg()) {
+                shelter = candidate;
+                chosen  = square;
+            }
+        };
+
+        if (board.has_castling_right(CASTLE_KINGSIDE, C))
+            consider_shelter(kingside_sq);
+        if (board.has_castling_right(CASTLE_QUEENSIDE, C))
+            consider_shelter(queenside_sq);
+
+        pawn_entry->shelter[C]          = shelter;
+        pawn_entry->shelter_king_sq[C]  = king_sq;
+        pawn_entry->shelter_castling[C] = rights;
+    }
 
     const TaperedScore danger = evaluate_danger<C>(king_sq);
 
-    return shelter - danger;
+    // Traces evaluate without a pawn table, so the shelter above was just chosen; only its
+    // coefficients are recorded, not those of the candidates it beat.
+    if constexpr (Tracing) {
+        (void)evaluate_shelter<true, C>(chosen);
+        coefficient_trace->add_fixed(C == WHITE ? -danger : danger);
+    }
+
+    return pawn_entry->shelter[C] - danger;
 }
 
 /// merge moves into attack bitboards
@@ -207,14 +293,15 @@ inline void Evaluator::update_attacks(const Bitboard moves) {
 }
 
 /// add mobility bonus for # of moves
-template <Color C, PieceType P>
+template <bool Tracing, Color C, PieceType P>
 inline void Evaluator::update_mobility(const Bitboard moves) {
     const int move_count = bb::count(moves & zones.mobility[C]);
     scores.mobility[C] += eval::mobility[P][move_count];
+    count<Tracing, C>(parameter::mobility[P] + move_count);
 }
 
 /// penalize weak pieces if outnumbered or attacked by a lower-value pawn
-template <Color C, PieceType P>
+template <bool Tracing, Color C, PieceType P>
 inline void Evaluator::update_threats(const PieceContext& ctx) {
     constexpr Color Opp = ~C;
 
@@ -224,11 +311,12 @@ inline void Evaluator::update_threats(const PieceContext& ctx) {
 
     if (attacked_by_pawn || bb::count(attackers) > bb::count(defenders)) {
         scores.threats[C] += eval::weak_piece[P];
+        count<Tracing, C>(parameter::weak_piece + P);
     }
 }
 
 /// update king attackers with attacks on enemy king zone
-template <Color C, PieceType P>
+template <bool Tracing, Color C, PieceType P>
 inline TaperedScore Evaluator::update_attackers(const PieceContext& ctx, const Bitboard moves) {
     constexpr Color Opp = ~C;
 
@@ -237,8 +325,10 @@ inline TaperedScore Evaluator::update_attackers(const PieceContext& ctx, const B
         king_attackers.value[Opp] += eval::kingzone_att_danger[P];
     } else if constexpr (P == BISHOP || P == ROOK) {
         const Bitboard xray_moves = attacks::piece_moves<P>(ctx.square, ctx.pawns);
-        if (zones.king[Opp] & xray_moves)
+        if (zones.king[Opp] & xray_moves) {
+            count<Tracing, C>(parameter::kingzone_xray_att);
             return eval::kingzone_xray_att;
+        }
     }
 
     return TaperedScore::Zero;
@@ -255,7 +345,7 @@ inline Bitboard Evaluator::get_moves(const PieceContext& ctx) const {
 }
 
 /// minor piece eval: outposts + pawn shields
-template <Color C, PieceType P>
+template <bool Tracing, Color C, PieceType P>
 inline TaperedScore Evaluator::evaluate_minor_pieces(const PieceContext& ctx,
                                                      const Bitboard      moves) const {
     constexpr Color Opp = ~C;
@@ -263,39 +353,46 @@ inline TaperedScore Evaluator::evaluate_minor_pieces(const PieceContext& ctx,
 
     TaperedScore score;
     if (bb::contains(zones.outposts[C], ctx.square)) {
-        if constexpr (P == KNIGHT)
+        if constexpr (P == KNIGHT) {
             score += eval::knight_outpost;
-        else
+            count<Tracing, C>(parameter::knight_outpost);
+        } else {
             score += eval::bishop_outpost;
+            count<Tracing, C>(parameter::bishop_outpost);
+        }
     } else if constexpr (P == KNIGHT) {
         if (moves & zones.outposts[C]) {
             score += eval::reachable_outpost;
+            count<Tracing, C>(parameter::reachable_outpost);
         }
     }
 
     if (bb::contains(attacks::pawn_shift<pawn_delta::push, Opp>(ctx.pawns), ctx.square)) {
         score += eval::minor_pawn_shield;
+        count<Tracing, C>(parameter::minor_pawn_shield);
     }
 
     return score;
 }
 
 /// bishop eval: long diagonals + pawn block penalty
-template <Color C>
+template <bool Tracing, Color C>
 inline TaperedScore Evaluator::evaluate_bishops(const PieceContext& ctx) const {
     TaperedScore score;
 
     const Bitboard xray_moves = attacks::piece_moves<BISHOP>(ctx.square, ctx.pawns);
-    if (bb::is_many(eval::masks::center_squares & xray_moves))
+    if (bb::is_many(eval::masks::center_squares & xray_moves)) {
         score += eval::bishop_long_diag;
+        count<Tracing, C>(parameter::bishop_long_diag);
+    }
 
-    score += evaluate_bishop_blockers<C>(ctx);
+    score += evaluate_bishop_blockers<Tracing, C>(ctx);
 
     return score;
 }
 
 /// penalize bishops blocked by pawns on the same color squares
-template <Color C>
+template <bool Tracing, Color C>
 inline TaperedScore Evaluator::evaluate_bishop_blockers(const PieceContext& ctx) const {
     constexpr Color Opp = ~C;
 
@@ -310,11 +407,12 @@ inline TaperedScore Evaluator::evaluate_bishop_blockers(const PieceContext& ctx)
     const Bitboard pawn_chain = ctx.piece_bb & attacks::pawn_attacks<C>(ctx.pawns);
     const int blocking_factor = bb::count(blocked_pawns & eval::masks::center_files) + !pawn_chain;
 
+    count<Tracing, C>(parameter::bishop_blockers, pawn_count * blocking_factor);
     return eval::bishop_blockers * (pawn_count * blocking_factor);
 }
 
 /// rook eval: open/semi-open file bonus, closed+blocked penalty
-template <Color C>
+template <bool Tracing, Color C>
 inline TaperedScore Evaluator::evaluate_rook(const PieceContext& ctx) const {
     constexpr Color Opp = ~C;
 
@@ -324,11 +422,13 @@ inline TaperedScore Evaluator::evaluate_rook(const PieceContext& ctx) const {
     const bool semi_open = !file_pawns;
     if (semi_open) {
         bool fully_open = !(ctx.opp_pawns & file_mask);
+        count<Tracing, C>(parameter::rook_open_file + fully_open);
         return eval::rook_open_file[fully_open];
     }
 
     const bool blocked = file_pawns & attacks::pawn_shift<pawn_delta::push, Opp>(ctx.occupied);
     if (blocked) {
+        count<Tracing, C>(parameter::rook_closed_file);
         return eval::rook_closed_file;
     }
 
@@ -336,9 +436,10 @@ inline TaperedScore Evaluator::evaluate_rook(const PieceContext& ctx) const {
 }
 
 /// queen eval: penalize discovered attacks
-template <Color C>
+template <bool Tracing, Color C>
 inline TaperedScore Evaluator::evaluate_queen(const PieceContext& ctx) const {
     if (discovery_attack<C, BISHOP>(ctx) || discovery_attack<C, ROOK>(ctx)) {
+        count<Tracing, C>(parameter::queen_discover_att);
         return eval::queen_discover_att;
     }
     return TaperedScore::Zero;
@@ -362,7 +463,7 @@ inline bool Evaluator::discovery_attack(const PieceContext& ctx) const {
 }
 
 /// king pawn-shelter score: friendly pawn shield vs enemy pawn storm
-template <Color C>
+template <bool Tracing, Color C>
 TaperedScore Evaluator::evaluate_shelter(const Square king_sq) const {
     constexpr Color Opp = ~C;
 
@@ -377,9 +478,9 @@ TaperedScore Evaluator::evaluate_shelter(const Square king_sq) const {
     const File     file            = std::clamp(king_file, FILE2, FILE7);
 
     TaperedScore score;
-    score += evaluate_shelter_file<C>(pawns_ahead, opp_pawns_ahead, file - 1);
-    score += evaluate_shelter_file<C>(pawns_ahead, opp_pawns_ahead, file);
-    score += evaluate_shelter_file<C>(pawns_ahead, opp_pawns_ahead, file + 1);
+    score += evaluate_shelter_file<Tracing, C>(pawns_ahead, opp_pawns_ahead, file - 1);
+    score += evaluate_shelter_file<Tracing, C>(pawns_ahead, opp_pawns_ahead, file);
+    score += evaluate_shelter_file<Tracing, C>(pawns_ahead, opp_pawns_ahead, file + 1);
 
     score += eval::king_file[king_file];
 
@@ -389,11 +490,14 @@ TaperedScore Evaluator::evaluate_shelter(const Square king_sq) const {
 
     score += eval::king_open_file[open_file][opp_open_file];
 
+    count<Tracing, C>(parameter::king_file + king_file);
+    count<Tracing, C>(parameter::king_open_file + 2 * open_file + opp_open_file);
+
     return score;
 }
 
 /// shelter score for one file: friendly pawn rank + enemy pawn rank
-template <Color C>
+template <bool Tracing, Color C>
 inline TaperedScore Evaluator::evaluate_shelter_file(const Bitboard pawns,
                                                      const Bitboard opp_pawns,
                                                      const File     file) const {
@@ -411,6 +515,9 @@ inline TaperedScore Evaluator::evaluate_shelter_file(const Bitboard pawns,
     score += eval::pawn_shelter[rank];
     score += eval::pawn_storm[blocked][opp_rank];
 
+    count<Tracing, C>(parameter::pawn_shelter + rank);
+    count<Tracing, C>(parameter::pawn_storm + std::size(eval::pawn_storm[0]) * blocked + opp_rank);
+
     return score;
 }
 
@@ -0,0 +1,48 @@
+#include "eval/linear_features.hpp"
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/material_table.hpp"
+#include "eval/parameters.hpp"
+
+namespace eval {
+
+std::optional<LinearFeatures> extract_features(const Board& board) {
+    if (MaterialTable::analyse(board).evaluation)
+        return std::nullopt;
+
+    const Trace    trace = evaluate_trace(board);
+    LinearFeatures features{
+        .fixed        = trace.fixed_score(),
+        .phase        = trace.phase(),
+        .scale        = {trace.scale(BLACK), trace.scale(WHITE)},
+        .side_to_move = trace.side_to_move(),
+    };
+
+    for (std::size_t index = 0; index < parameter::count; ++index) {
+        if (const int value = trace.coefficient(index))
+            features.coefficients.push_back(
+                {static_cast<std::uint16_t>(index), static_cast<std::int16_t>(value)});
+    }
+    return features;
+}
+
+TaperedScore linear_score(const LinearFeatures& features, const ParameterVector& weights) {
+    TaperedScore score = features.fixed;
+    for (const FeatureCoefficient coefficient : features.coefficients)
+        score += weights[coefficient.parameter] * coefficient.value;
+    return score;
+}
+
+EvalValue linear_value(const LinearFeatures& features, const ParameterVector& weights) {
+    TaperedScore score = linear_score(features, weights);
+
+    const Color stronger_side = score.eg() < 0 ? BLACK : WHITE;
+    score = {score.mg(), (score.eg() * features.scale[stronger_side]) / scale_limit};
+
+    const EvalValue tapered =
+        (score.mg() * features.phase + score.eg() * (phase_limit - features.phase)) / phase_limit;
+    return tapered * (features.side_to_move == WHITE ? 1 : -1) + tempo_bonus;
+}
+
+} // namespace eval
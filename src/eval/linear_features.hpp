@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "core/types.hpp"
+#include "eval/parameter_vector.hpp"
+#include "eval/tapered_score.hpp"
+
+class Board;
+
+namespace eval {
+
+struct FeatureCoefficient {
+    std::uint16_t parameter;
+    std::int16_t  value;
+};
+
+// Sparse linear view of one evaluation for tuning: the evaluator's unscaled White-relative
+// score is fixed plus the sum of value * weight over coefficients, which ascend by parameter.
+struct LinearFeatures {
+    std::vector<FeatureCoefficient> coefficients;
+    TaperedScore                    fixed           = TaperedScore::Zero;
+    int                             phase           = 0;
+    int                             scale[N_COLORS] = {0};
+    Color                           side_to_move    = WHITE;
+};
+
+// Extracts features from evaluate_trace(board). Returns nullopt for known endgames, whose value
+// is not a function of the weights.
+[[nodiscard]] std::optional<LinearFeatures> extract_features(const Board& board);
+
+// The unscaled score the features predict under weights.
+[[nodiscard]] TaperedScore linear_score(const LinearFeatures& features,
+                                        const ParameterVector& weights);
+
+// evaluate()'s side-to-move value under weights, with the evaluator's integer scaling, tapering
+// and tempo.
+[[nodiscard]] EvalValue linear_value(const LinearFeatures& features,
+                                     const ParameterVector& weights);
+
+} // namespace eval
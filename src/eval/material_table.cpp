@@ -0,0 +1,101 @@
+#include "eval/material_table.hpp"
+
+#include <algorithm>
+
+#include "board/board.hpp"
+#include "eval/parameters.hpp"
+
+namespace eval {
+
+namespace {
+
+bool is_bare_king(const Board& board, Color color) {
+    return board.count(color, PAWN) == 0 && board.non_pawn_material(color) == 0;
+}
+
+// Default scale for color as the stronger side.
+int material_scale(const Board& board, Color color) {
+    const int pawns        = board.count(color, PAWN);
+    const int material     = board.non_pawn_material(color);
+    const int opp_material = board.non_pawn_material(~color);
+
+    // Two knights cannot force mate.
+    if (pawns == 0 && material == 2 * eval::knight.mg() && board.count(color, KNIGHT) == 2)
+        return 0;
+
+    // Without pawns, an edge of at most a minor piece rarely converts.
+    if (pawns == 0 && material - opp_material <= eval::bishop.mg()) {
+        if (material < eval::rook.mg())
+            return 0;
+        return opp_material <= eval::bishop.mg() ? 4 : 14;
+    }
+
+    return std::min(eval::scale_limit, eval::scale_base + eval::scale_per_pawn * pawns);
+}
+
+// Assigns a specialised evaluation when color faces a bare king with a known pattern.
+bool assign_endgame(const Board& board, Color color, MaterialEntry& entry) {
+    if (!is_bare_king(board, ~color))
+        return false;
+
+    const int pawns    = board.count(color, PAWN);
+    const int material = board.non_pawn_material(color);
+
+    if (pawns == 0 && material == eval::bishop.mg() + eval::knight.mg()
+        && board.count(color, BISHOP) == 1 && board.count(color, KNIGHT) == 1)
+        entry.evaluation = endgame::kbnk;
+    else if (pawns == 0 && material == 2 * eval::knight.mg() && board.count(color, KNIGHT) == 2)
+        entry.evaluation = endgame::draw;
+    else if (pawns == 1 && material == 0)
+        entry.evaluation = endgame::kpk;
+    else if (material >= eval::rook.mg())
+        entry.evaluation = endgame::kxk;
+    else
+        return false;
+
+    entry.strong_side = color;
+    return true;
+}
+
+} // namespace
+
+MaterialEntry& MaterialTable::probe(const Board& board) {
+    MaterialEntry& entry = entries[board.material_key() & (size - 1)];
+    if (entry.key != board.material_key())
+        entry = analyse(board);
+    return entry;
+}
+
+MaterialEntry MaterialTable::analyse(const Board& board) {
+    MaterialEntry entry;
+    entry.key = board.material_key();
+
+    const int non_pawn_material = board.non_pawn_material(WHITE) + board.non_pawn_material(BLACK);
+    const int material = std::clamp(non_pawn_material, eval::material_eg, eval::material_mg);
+
+    entry.phase = ((material - eval::material_eg) * eval::phase_limit)
+                / (eval::material_mg - eval::material_eg);
+
+    entry.scale[WHITE] = material_scale(board, WHITE);
+    entry.scale[BLACK] = material_scale(board, BLACK);
+
+    // Neither side has pawns or more than a minor piece: no mate is possible.
+    const bool no_pawns = board.count(WHITE, PAWN) == 0 && board.count(BLACK, PAWN) == 0;
+    if (no_pawns && board.non_pawn_material(WHITE) <= eval::bishop.mg()
+        && board.non_pawn_material(BLACK) <= eval::bishop.mg()) {
+        entry.evaluation = endgame::draw;
+        return entry;
+    }
+
+    if (assign_endgame(board, WHITE, entry) || assign_endgame(board, BLACK, entry))
+        return entry;
+
+    // One bishop each and nothing else besides pawns; the square colours decide at evaluation.
+    if (board.non_pawn_material(WHITE) == eval::bishop.mg() && board.count(WHITE, BISHOP) == 1
+        && board.non_pawn_material(BLACK) == eval::bishop.mg() && board.count(BLACK, BISHOP) == 1)
+        entry.scaling = endgame::opposite_bishops;
+
+    return entry;
+}
+
+} // namespace eval
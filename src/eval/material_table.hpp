@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "core/types.hpp"
+#include "eval/endgame.hpp"
+
+class Board;
+
+namespace eval {
+
+// Evaluation data that depends only on piece counts. A zero key never occurs because kings
+// are part of every material key, so empty slots always miss.
+struct MaterialEntry {
+    PositionKey key = 0;
+    // Game phase: zero is endgame and phase_limit is middlegame.
+    int phase = 0;
+    // Endgame scale numerator over scale_limit, indexed by the stronger side.
+    int scale[N_COLORS] = {0, 0};
+
+    // Known endgames short-circuit the evaluator; scaling refines scale at evaluation time.
+    EndgameEval  evaluation  = nullptr;
+    EndgameScale scaling     = nullptr;
+    Color        strong_side = WHITE;
+};
+
+// Direct-mapped material hash owned by one search worker. Material only changes on captures
+// and promotions, so nearly every lookup hits.
+class MaterialTable {
+public:
+    static constexpr std::size_t size = std::size_t{1} << 13;
+
+    MaterialTable() : entries(size) {}
+
+    // Returns the entry for board's material, analysing it on a miss.
+    [[nodiscard]] MaterialEntry& probe(const Board& board);
+
+    void clear() { entries.assign(size, MaterialEntry{}); }
+
+    [[nodiscard]] static MaterialEntry analyse(const Board& board);
+
+private:
+    std::vector<MaterialEntry> entries;
+};
+
+} // namespace eval
@@ -0,0 +1,95 @@
+#include "eval/nnue/accumulator.hpp"
+
+#include <algorithm>
+#include <span>
+
+#include "board/board.hpp"
+#include "eval/nnue/kernels.hpp"
+#include "eval/nnue/network.hpp"
+
+namespace eval::nnue {
+
+namespace {
+
+const std::int16_t* feature_row(const Network& network, std::size_t feature) {
+    return network.feature_weights.data() + feature * accumulator_size;
+}
+
+// Applies one ply's placement changes to both perspectives.
+void apply_dirty_pieces(Accumulator&    accumulator,
+                        const PlyState& state,
+                        const Network&  network,
+                        const Kernels&  kernels) {
+    for (std::size_t index = 0; index < state.dirty_count; ++index) {
+        const DirtyPiece& dirty = state.dirty_pieces[index];
+        for (Color perspective : {BLACK, WHITE}) {
+            std::int16_t* values = accumulator.values[perspective];
+            if (dirty.from != INVALID) {
+                const std::size_t feature = feature_index(perspective, dirty.piece, dirty.from);
+                kernels.sub_row(values, feature_row(network, feature));
+            }
+            if (dirty.to != INVALID) {
+                const std::size_t feature = feature_index(perspective, dirty.piece, dirty.to);
+                kernels.add_row(values, feature_row(network, feature));
+            }
+        }
+    }
+}
+
+} // namespace
+
+void AccumulatorStack::refresh(Accumulator&   accumulator,
+                               const Board&   board,
+                               const Network& network) {
+    const Kernels& kernels = active_kernels();
+    for (Color perspective : {BLACK, WHITE}) {
+        std::int16_t* values = accumulator.values[perspective];
+        std::ranges::copy(network.feature_biases, values);
+
+        Bitboard occupied = board.occupancy();
+        while (occupied) {
+            const Square square = bb::lsb_pop(occupied);
+            kernels.add_row(
+                values,
+                feature_row(network, feature_index(perspective, board.piece_on(square), square)));
+        }
+    }
+}
+
+const Accumulator& AccumulatorStack::update(const Board& board, const Network& network) {
+    const std::span<const PlyState> history = board.history();
+    const std::size_t               current = history.size() - 1;
+    if (entries.size() < history.size())
+        entries.resize(history.size());
+
+    auto reusable = [&](std::size_t index) {
+        return entries[index].computed && entries[index].key == history[index].zkey;
+    };
+
+    // Nearest reusable ancestor within max_replay plies; none means a refresh.
+    std::size_t base  = current;
+    bool        found = reusable(current);
+    while (!found && base > 0 && current - base < max_replay) {
+        --base;
+        found = reusable(base);
+    }
+
+    if (!found) {
+        base = current;
+        refresh(entries[current].accumulator, board, network);
+    }
+
+    const Kernels& kernels = active_kernels();
+    for (std::size_t index = base + 1; index <= current; ++index) {
+        entries[index].accumulator = entries[index - 1].accumulator;
+        apply_dirty_pieces(entries[index].accumulator, history[index], network, kernels);
+        entries[index].key      = history[index].zkey;
+        entries[index].computed = true;
+    }
+
+    entries[current].key      = history[current].zkey;
+    entries[current].computed = true;
+    return entries[current].accumulator;
+}
+
+} // namespace eval::nnue
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "core/types.hpp"
+#include "eval/nnue/architecture.hpp"
+
+class Board;
+
+namespace eval::nnue {
+
+class Network;
+
+// Feature-transformer output for one position, one half per perspective.
+struct Accumulator {
+    alignas(64) std::int16_t values[N_COLORS][accumulator_size];
+};
+
+// Accumulators along one board's history, indexed like Board::history(). Each entry records
+// the position key it was computed for, so entries left behind by another line are rebuilt
+// instead of reused, and a search can pick up entries from the previous one.
+class AccumulatorStack {
+public:
+    // Accumulator for board's current position. Replays the dirty pieces of at most
+    // max_replay plies from the nearest reusable ancestor, else refreshes from the pieces.
+    [[nodiscard]] const Accumulator& update(const Board& board, const Network& network);
+
+    void clear() { entries.clear(); }
+
+    static constexpr std::size_t max_replay = 8;
+
+    // Accumulator built from scratch, for verification and one-off evaluations.
+    static void refresh(Accumulator& accumulator, const Board& board, const Network& network);
+
+private:
+    struct Entry {
+        PositionKey key      = 0;
+        bool        computed = false;
+        Accumulator accumulator;
+    };
+
+    std::vector<Entry> entries;
+};
+
+} // namespace eval::nnue
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/piece.hpp"
+#include "core/square.hpp"
+#include "core/types.hpp"
+
+namespace eval::nnue {
+
+// A 768 -> 2x256 -> 16 -> 1 network. Each perspective's feature transformer sums one int16
+// row per piece, indexed by piece colour relative to the perspective, piece type and square
+// seen from that side. The side to move's half comes first in the hidden layer's input.
+inline constexpr std::size_t input_size       = 2 * piece_slots * N_SQUARES;
+inline constexpr std::size_t accumulator_size = 256;
+inline constexpr std::size_t hidden_input     = 2 * accumulator_size;
+inline constexpr std::size_t hidden_size      = 16;
+
+// Quantisation: accumulators and hidden outputs are clipped to [0, activation_max] before
+// feeding the int8 layer above, hidden sums are shifted right by hidden_shift, and the
+// output sum is divided by output_divisor to give an EvalValue.
+inline constexpr int activation_max = 127;
+inline constexpr int hidden_shift   = 6;
+inline constexpr int output_divisor = 16;
+
+// Hidden-layer input rows are padded so every SIMD kernel reads whole registers.
+static_assert(accumulator_size % 32 == 0);
+static_assert(hidden_input % 32 == 0);
+
+[[nodiscard]] constexpr std::size_t
+feature_index(Color perspective, Color color, PieceType piece_type, Square square) noexcept {
+    const std::size_t side     = color == perspective ? 0 : 1;
+    const std::size_t relative = perspective == WHITE ? square : square ^ 56;
+    return (side * piece_slots + piece_slot(piece_type)) * N_SQUARES + relative;
+}
+
+[[nodiscard]] constexpr std::size_t
+feature_index(Color perspective, Piece piece, Square square) noexcept {
+    return feature_index(perspective, color_of(piece), type_of(piece), square);
+}
+
+} // namespace eval::nnue
@@ -0,0 +1,177 @@
+#include "eval/nnue/kernels.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "eval/nnue/architecture.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define LATRUNCULI_NNUE_X86 1
+#else
+#define LATRUNCULI_NNUE_X86 0
+#endif
+
+namespace eval::nnue {
+
+namespace {
+
+void scalar_add_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; ++i)
+        accumulator[i] = std::int16_t(accumulator[i] + row[i]);
+}
+
+void scalar_sub_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; ++i)
+        accumulator[i] = std::int16_t(accumulator[i] - row[i]);
+}
+
+void scalar_activate(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them) {
+    for (std::size_t i = 0; i < accumulator_size; ++i) {
+        output[i]                    = std::uint8_t(std::clamp<int>(us[i], 0, activation_max));
+        output[accumulator_size + i] = std::uint8_t(std::clamp<int>(them[i], 0, activation_max));
+    }
+}
+
+std::int32_t scalar_dot(const std::uint8_t* input, const std::int8_t* weights) {
+    std::int32_t sum = 0;
+    for (std::size_t i = 0; i < hidden_input; ++i)
+        sum += std::int32_t(input[i]) * weights[i];
+    return sum;
+}
+
+constexpr Kernels scalar_kernels{
+    "scalar", scalar_add_row, scalar_sub_row, scalar_activate, scalar_dot};
+
+#if LATRUNCULI_NNUE_X86
+
+[[gnu::target("sse4.1")]] void sse41_add_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; i += 8) {
+        auto*         lane   = reinterpret_cast<__m128i*>(accumulator + i);
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        _mm_storeu_si128(lane, _mm_add_epi16(_mm_loadu_si128(lane), values));
+    }
+}
+
+[[gnu::target("sse4.1")]] void sse41_sub_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; i += 8) {
+        auto*         lane   = reinterpret_cast<__m128i*>(accumulator + i);
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        _mm_storeu_si128(lane, _mm_sub_epi16(_mm_loadu_si128(lane), values));
+    }
+}
+
+[[gnu::target("sse4.1")]] void
+sse41_activate_half(std::uint8_t* output, const std::int16_t* accumulator) {
+    const __m128i zero = _mm_setzero_si128();
+    for (std::size_t i = 0; i < accumulator_size; i += 16) {
+        const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulator + i));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulator + i + 8));
+        // Signed saturation to [-128, 127] followed by max(0) clips to [0, activation_max].
+        const __m128i packed = _mm_max_epi8(_mm_packs_epi16(low, high), zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+    }
+}
+
+[[gnu::target("sse4.1")]] void
+sse41_activate(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them) {
+    sse41_activate_half(output, us);
+    sse41_activate_half(output + accumulator_size, them);
+}
+
+[[gnu::target("sse4.1")]] std::int32_t sse41_dot(const std::uint8_t* input,
+                                                 const std::int8_t*  weights) {
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i       sum  = _mm_setzero_si128();
+    for (std::size_t i = 0; i < hidden_input; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        const __m128i w  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+        // Pair sums stay within int16: 2 * 127 * 128 < 32768.
+        sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+    }
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+    return _mm_cvtsi128_si32(sum);
+}
+
+[[gnu::target("avx2")]] void avx2_add_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; i += 16) {
+        auto*         lane   = reinterpret_cast<__m256i*>(accumulator + i);
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+        _mm256_storeu_si256(lane, _mm256_add_epi16(_mm256_loadu_si256(lane), values));
+    }
+}
+
+[[gnu::target("avx2")]] void avx2_sub_row(std::int16_t* accumulator, const std::int16_t* row) {
+    for (std::size_t i = 0; i < accumulator_size; i += 16) {
+        auto*         lane   = reinterpret_cast<__m256i*>(accumulator + i);
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+        _mm256_storeu_si256(lane, _mm256_sub_epi16(_mm256_loadu_si256(lane), values));
+    }
+}
+
+[[gnu::target("avx2")]] void avx2_activate_half(std::uint8_t*       output,
+                                                const std::int16_t* accumulator) {
+    const __m256i zero = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < accumulator_size; i += 32) {
+        const auto*   lanes = reinterpret_cast<const __m256i*>(accumulator + i);
+        const __m256i low   = _mm256_loadu_si256(lanes);
+        const __m256i high  = _mm256_loadu_si256(lanes + 1);
+        // packs works within 128-bit lanes; restore element order across them.
+        const __m256i packed =
+            _mm256_permute4x64_epi64(_mm256_max_epi8(_mm256_packs_epi16(low, high), zero), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+    }
+}
+
+[[gnu::target("avx2")]] void
+avx2_activate(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them) {
+    avx2_activate_half(output, us);
+    avx2_activate_half(output + accumulator_size, them);
+}
+
+[[gnu::target("avx2")]] std::int32_t avx2_dot(const std::uint8_t* input,
+                                              const std::int8_t*  weights) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i       sum  = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < hidden_input; i += 32) {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256i w  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+    }
+    __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    half         = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half         = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    return _mm_cvtsi128_si32(half);
+}
+
+constexpr Kernels sse41_kernels{"sse4.1", sse41_add_row, sse41_sub_row, sse41_activate, sse41_dot};
+constexpr Kernels avx2_kernels{"avx2", avx2_add_row, avx2_sub_row, avx2_activate, avx2_dot};
+
+#endif
+
+std::vector<Kernels> detect_kernels() {
+    std::vector<Kernels> kernels{scalar_kernels};
+#if LATRUNCULI_NNUE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.1"))
+        kernels.push_back(sse41_kernels);
+    if (__builtin_cpu_supports("avx2"))
+        kernels.push_back(avx2_kernels);
+#endif
+    return kernels;
+}
+
+} // namespace
+
+std::span<const Kernels> supported_kernels() {
+    static const std::vector<Kernels> kernels = detect_kernels();
+    return kernels;
+}
+
+const Kernels& active_kernels() {
+    static const Kernels& kernels = supported_kernels().back();
+    return kernels;
+}
+
+} // namespace eval::nnue
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace eval::nnue {
+
+// Inner loops of network inference, implemented once per instruction set. Every set produces
+// bit-identical results; int16 accumulator lanes wrap on overflow in all of them.
+struct Kernels {
+    const char* name;
+
+    // accumulator[i] += row[i] (or -=) over accumulator_size lanes.
+    void (*add_row)(std::int16_t* accumulator, const std::int16_t* row);
+    void (*sub_row)(std::int16_t* accumulator, const std::int16_t* row);
+
+    // Clips both accumulators to [0, activation_max], side to move first, into hidden_input
+    // activations.
+    void (*activate)(std::uint8_t* output, const std::int16_t* us, const std::int16_t* them);
+
+    // Dot product of hidden_input activations with one row of int8 hidden weights.
+    std::int32_t (*dot)(const std::uint8_t* input, const std::int8_t* weights);
+};
+
+// Fastest kernels the running CPU supports, detected once.
+[[nodiscard]] const Kernels& active_kernels();
+
+// Every kernel set the running CPU supports, scalar first.
+[[nodiscard]] std::span<const Kernels> supported_kernels();
+
+} // namespace eval::nnue
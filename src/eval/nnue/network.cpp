@@ -0,0 +1,151 @@
+#include "eval/nnue/network.hpp"
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "board/board.hpp"
+#include "core/constants.hpp"
+#include "eval/eval_cache.hpp"
+#include "eval/nnue/kernels.hpp"
+
+namespace eval::nnue {
+
+namespace {
+
+// Network files hold this header followed by each parameter array in declaration order, in
+// host byte order like hash files.
+struct NetworkFileHeader {
+    std::array<char, 8> magic;
+    std::uint32_t       version;
+    std::uint32_t       input_size;
+    std::uint32_t       accumulator_size;
+    std::uint32_t       hidden_size;
+};
+static_assert(sizeof(NetworkFileHeader) == 24);
+
+constexpr std::array<char, 8> network_file_magic   = {'L', 'A', 'T', 'R', 'N', 'N', 'U', 'E'};
+constexpr std::uint32_t       network_file_version = 1;
+
+// Network values stay inside the TT's mate guard band, like known endgame wins.
+constexpr EvalValue value_limit = eval_value::tt_mate_bound - 1;
+
+// Parameters is Network or const Network, for loading and saving respectively.
+template <typename Parameters, typename Visitor>
+void visit_parameters(Parameters& network, Visitor visit) {
+    visit(network.feature_biases);
+    visit(network.feature_weights);
+    visit(network.hidden_biases);
+    visit(network.hidden_weights);
+    visit(network.output_bias);
+    visit(network.output_weights);
+}
+
+NetworkFileHeader expected_header() {
+    return {
+        .magic            = network_file_magic,
+        .version          = network_file_version,
+        .input_size       = std::uint32_t(input_size),
+        .accumulator_size = std::uint32_t(accumulator_size),
+        .hidden_size      = std::uint32_t(hidden_size),
+    };
+}
+
+constexpr std::size_t parameter_bytes =
+    sizeof(Network::feature_biases) + sizeof(Network::feature_weights)
+    + sizeof(Network::hidden_biases) + sizeof(Network::hidden_weights)
+    + sizeof(Network::output_bias) + sizeof(Network::output_weights);
+
+} // namespace
+
+std::unique_ptr<Network> Network::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("cannot open network file: " + path);
+
+    NetworkFileHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || header.magic != network_file_magic)
+        throw std::runtime_error("not a network file: " + path);
+
+    const NetworkFileHeader expected = expected_header();
+    if (header.version != expected.version || header.input_size != expected.input_size
+        || header.accumulator_size != expected.accumulator_size
+        || header.hidden_size != expected.hidden_size)
+        throw std::runtime_error("unsupported network architecture: " + path);
+
+    std::error_code error;
+    if (std::filesystem::file_size(path, error) != sizeof(header) + parameter_bytes || error)
+        throw std::runtime_error("corrupt network file: " + path);
+
+    auto network = std::make_unique<Network>();
+    visit_parameters(*network, [&](auto& values) {
+        file.read(reinterpret_cast<char*>(&values), sizeof(values));
+    });
+    if (!file)
+        throw std::runtime_error("corrupt network file: " + path);
+    return network;
+}
+
+void Network::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw std::runtime_error("cannot create network file: " + path);
+
+    const NetworkFileHeader header = expected_header();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    visit_parameters(*this, [&](const auto& values) {
+        file.write(reinterpret_cast<const char*>(&values), sizeof(values));
+    });
+    if (!file.flush())
+        throw std::runtime_error("cannot write network file: " + path);
+}
+
+std::uint64_t Network::fingerprint() const {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    visit_parameters(*this, [&](const auto& values) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&values);
+        for (std::size_t i = 0; i < sizeof(values); ++i)
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    });
+    return hash;
+}
+
+EvalValue Network::evaluate(const Accumulator& accumulator, Color side_to_move) const {
+    const Kernels& kernels = active_kernels();
+
+    alignas(64) std::uint8_t input[hidden_input];
+    kernels.activate(input, accumulator.values[side_to_move], accumulator.values[~side_to_move]);
+
+    std::int32_t output = output_bias;
+    for (std::size_t neuron = 0; neuron < hidden_size; ++neuron) {
+        const std::int8_t* weights = hidden_weights.data() + neuron * hidden_input;
+        const std::int32_t sum     = hidden_biases[neuron] + kernels.dot(input, weights);
+        output += std::clamp(sum >> hidden_shift, 0, activation_max) * output_weights[neuron];
+    }
+
+    return std::clamp<EvalValue>(output / output_divisor, -value_limit, value_limit);
+}
+
+EvalValue evaluate(const Board& board, const Network& network) {
+    Accumulator accumulator;
+    AccumulatorStack::refresh(accumulator, board, network);
+    return network.evaluate(accumulator, board.side_to_move());
+}
+
+CachedEvaluation evaluate_cached(const Board&      board,
+                                 EvalCache&        eval_cache,
+                                 AccumulatorStack& accumulators,
+                                 const Network&    network) {
+    EvalCacheEntry& entry = eval_cache[board.key()];
+    if (entry.key == board.key() && entry.value != eval_value::none)
+        return {entry.value, true};
+
+    entry.key   = board.key();
+    entry.value = network.evaluate(accumulators.update(board, network), board.side_to_move());
+    return {entry.value, false};
+}
+
+} // namespace eval::nnue
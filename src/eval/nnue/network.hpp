@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "core/types.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/nnue/accumulator.hpp"
+#include "eval/nnue/architecture.hpp"
+
+class Board;
+
+namespace eval {
+
+class EvalCache;
+
+namespace nnue {
+
+// Quantised parameters of an efficiently updatable evaluation network. A loaded network is
+// immutable and shared by every search worker; the handcrafted evaluator remains the
+// fallback whenever none is loaded.
+class Network {
+public:
+    // Reads a network file; throws std::runtime_error if it is missing, truncated, or built
+    // for another architecture.
+    [[nodiscard]] static std::unique_ptr<Network> load(const std::string& path);
+    void                                          save(const std::string& path) const;
+
+    // Side-to-move value of the position whose features accumulator holds.
+    [[nodiscard]] EvalValue evaluate(const Accumulator& accumulator, Color side_to_move) const;
+    // FNV-1a hash of every parameter; identifies the evaluator whose values a TT holds.
+    [[nodiscard]] std::uint64_t fingerprint() const;
+
+    // Feature transformer: one row of accumulator_size weights per input feature.
+    alignas(64) std::array<std::int16_t, accumulator_size> feature_biases{};
+    alignas(64) std::array<std::int16_t, input_size * accumulator_size> feature_weights{};
+
+    // Hidden layer: one row of hidden_input weights per output.
+    std::array<std::int32_t, hidden_size> hidden_biases{};
+    alignas(64) std::array<std::int8_t, hidden_size * hidden_input> hidden_weights{};
+
+    std::int32_t                         output_bias = 0;
+    std::array<std::int8_t, hidden_size> output_weights{};
+};
+
+// Network value of board, refreshing a one-off accumulator.
+[[nodiscard]] EvalValue evaluate(const Board& board, const Network& network);
+
+// Network counterpart of eval::evaluate_cached: the same eval cache, with accumulators updated
+// incrementally along board's history.
+[[nodiscard]] CachedEvaluation evaluate_cached(const Board&      board,
+                                               EvalCache&        eval_cache,
+                                               AccumulatorStack& accumulators,
+                                               const Network&    network);
+
+} // namespace nnue
+
+} // namespace eval
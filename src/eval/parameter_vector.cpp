@@ -0,0 +1,192 @@
+#include "eval/parameter_vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace eval {
+
+namespace {
+
+#if LATRUNCULI_TUNABLE_EVAL
+using Storage = TaperedScore;
+#else
+using Storage = const TaperedScore;
+#endif
+
+std::span<Storage> storage(Storage& value) {
+    return {&value, 1};
+}
+
+template <std::size_t N>
+std::span<Storage> storage(Storage (&values)[N]) {
+    return values;
+}
+
+template <std::size_t N, std::size_t M>
+std::span<Storage> storage(Storage (&values)[N][M]) {
+    return {&values[0][0], N * M};
+}
+
+constexpr std::array<ParameterGroup, 30> groups = {{
+    {"psqt_pawn", parameter::psqt + piece_slot(PAWN) * N_SQUARES, N_SQUARES},
+    {"psqt_knight", parameter::psqt + piece_slot(KNIGHT) * N_SQUARES, N_SQUARES},
+    {"psqt_bishop", parameter::psqt + piece_slot(BISHOP) * N_SQUARES, N_SQUARES},
+    {"psqt_rook", parameter::psqt + piece_slot(ROOK) * N_SQUARES, N_SQUARES},
+    {"psqt_queen", parameter::psqt + piece_slot(QUEEN) * N_SQUARES, N_SQUARES},
+    {"psqt_king", parameter::psqt + piece_slot(KING) * N_SQUARES, N_SQUARES},
+    {"iso_pawn", parameter::iso_pawn, 1},
+    {"backward_pawn", parameter::backward_pawn, 1},
+    {"doubled_pawn", parameter::doubled_pawn, 1},
+    {"passed_pawn", parameter::passed_pawn, std::size(passed_pawn)},
+    {"reachable_outpost", parameter::reachable_outpost, 1},
+    {"bishop_outpost", parameter::bishop_outpost, 1},
+    {"knight_outpost", parameter::knight_outpost, 1},
+    {"minor_pawn_shield", parameter::minor_pawn_shield, 1},
+    {"bishop_long_diag", parameter::bishop_long_diag, 1},
+    {"bishop_pair", parameter::bishop_pair, 1},
+    {"bishop_blockers", parameter::bishop_blockers, 1},
+    {"rook_closed_file", parameter::rook_closed_file, 1},
+    {"kingzone_xray_att", parameter::kingzone_xray_att, 1},
+    {"queen_discover_att", parameter::queen_discover_att, 1},
+    {"rook_open_file", parameter::rook_open_file, std::size(rook_open_file)},
+    {"pawn_shelter", parameter::pawn_shelter, std::size(pawn_shelter)},
+    {"pawn_storm", parameter::pawn_storm, parameter::king_open_file - parameter::pawn_storm},
+    {"king_open_file",
+     parameter::king_open_file,
+     parameter::king_file - parameter::king_open_file},
+    {"king_file", parameter::king_file, std::size(king_file)},
+    {"weak_piece", parameter::weak_piece, std::size(weak_piece)},
+    {"knight_mob", parameter::knight_mob, std::size(knight_mob)},
+    {"bishop_mob", parameter::bishop_mob, std::size(bishop_mob)},
+    {"rook_mob", parameter::rook_mob, std::size(rook_mob)},
+    {"queen_mob", parameter::queen_mob, std::size(queen_mob)},
+}};
+
+static_assert(groups.back().offset + groups.back().size == parameter::count);
+
+// Storage for every group after the PSQT, which keeps its mg and eg halves in separate tables.
+std::array<std::span<Storage>, groups.size() - piece_slots> score_storage() {
+    return {{
+        storage(iso_pawn),          storage(backward_pawn),      storage(doubled_pawn),
+        storage(passed_pawn),       storage(reachable_outpost),  storage(bishop_outpost),
+        storage(knight_outpost),    storage(minor_pawn_shield),  storage(bishop_long_diag),
+        storage(bishop_pair),       storage(bishop_blockers),    storage(rook_closed_file),
+        storage(kingzone_xray_att), storage(queen_discover_att), storage(rook_open_file),
+        storage(pawn_shelter),      storage(pawn_storm),         storage(king_open_file),
+        storage(king_file),         storage(weak_piece),         storage(knight_mob),
+        storage(bishop_mob),        storage(rook_mob),           storage(queen_mob),
+    }};
+}
+
+[[noreturn]] void fail(int line_number, std::string_view message) {
+    throw std::runtime_error("invalid parameter file at line " + std::to_string(line_number) + ": "
+                             + std::string(message));
+}
+
+} // namespace
+
+std::span<const ParameterGroup> parameter_groups() {
+    return groups;
+}
+
+ParameterVector current_parameters() {
+    ParameterVector weights(parameter::count);
+
+    for (int slot = 0; slot < piece_slots; ++slot) {
+        for (int square = 0; square < N_SQUARES; ++square) {
+            weights[parameter::psqt + slot * N_SQUARES + square] = {
+                piece_squares[slot][std::to_underlying(Phase::Midgame)][square],
+                piece_squares[slot][std::to_underlying(Phase::Endgame)][square]};
+        }
+    }
+
+    const auto scores = score_storage();
+    for (std::size_t index = 0; index < scores.size(); ++index)
+        std::ranges::copy(scores[index], weights.begin() + groups[piece_slots + index].offset);
+
+    return weights;
+}
+
+ParameterVector read_parameters(std::istream& input) {
+    ParameterVector weights = current_parameters();
+
+    std::string line;
+    for (int line_number = 1; std::getline(input, line); ++line_number) {
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream fields(line);
+        std::string        name;
+        if (!(fields >> name))
+            continue;
+
+        const auto group = std::ranges::find(groups, name, &ParameterGroup::name);
+        if (group == groups.end())
+            fail(line_number, "unknown group " + name);
+
+        std::size_t index = 0;
+        EvalValue   mg    = 0;
+        EvalValue   eg    = 0;
+        std::string extra;
+        if (!(fields >> index >> mg >> eg) || (fields >> extra))
+            fail(line_number, "expected group, index, mg and eg");
+        if (index >= group->size)
+            fail(line_number, "index out of range for " + name);
+
+        weights[group->offset + index] = {mg, eg};
+    }
+
+    return weights;
+}
+
+void write_parameters(std::ostream& output, const ParameterVector& weights) {
+    if (weights.size() != parameter::count)
+        throw std::invalid_argument("parameter vector has the wrong size");
+
+    output << "# group index mg eg\n";
+    for (const ParameterGroup& group : groups) {
+        for (std::size_t index = 0; index < group.size; ++index) {
+            const TaperedScore score = weights[group.offset + index];
+            output << group.name << ' ' << index << ' ' << score.mg() << ' ' << score.eg() << '\n';
+        }
+    }
+}
+
+void apply_parameters(const ParameterVector& weights) {
+    if (weights.size() != parameter::count)
+        throw std::invalid_argument("parameter vector has the wrong size");
+
+#if LATRUNCULI_TUNABLE_EVAL
+    for (int slot = 0; slot < piece_slots; ++slot) {
+        for (int square = 0; square < N_SQUARES; ++square) {
+            const TaperedScore score = weights[parameter::psqt + slot * N_SQUARES + square];
+            piece_squares[slot][std::to_underlying(Phase::Midgame)][square] = score.mg();
+            piece_squares[slot][std::to_underlying(Phase::Endgame)][square] = score.eg();
+        }
+    }
+
+    const auto scores = score_storage();
+    for (std::size_t index = 0; index < scores.size(); ++index) {
+        const auto begin = weights.begin() + groups[piece_slots + index].offset;
+        std::ranges::copy(begin, begin + scores[index].size(), scores[index].begin());
+    }
+#else
+    throw std::runtime_error(
+        "evaluation parameters are compiled in; configure with -DLATRUNCULI_TUNABLE_EVAL=ON");
+#endif
+}
+
+void load_parameters(const std::string& path) {
+    std::ifstream input(path);
+    if (!input)
+        throw std::runtime_error("cannot open parameter file: " + path);
+
+    apply_parameters(read_parameters(input));
+}
+
+} // namespace eval
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/piece.hpp"
+#include "eval/parameters.hpp"
+#include "eval/tapered_score.hpp"
+
+namespace eval {
+
+// Flat index of each tunable weight in a ParameterVector, in parameters.hpp order. Tables are
+// flattened row-major; PSQT entries are indexed by piece slot and White-relative square.
+// Material, tempo, scaling and king danger are not linear in any single weight and stay fixed.
+namespace parameter {
+
+inline constexpr std::size_t psqt               = 0;
+inline constexpr std::size_t iso_pawn           = psqt + piece_slots * N_SQUARES;
+inline constexpr std::size_t backward_pawn      = iso_pawn + 1;
+inline constexpr std::size_t doubled_pawn       = backward_pawn + 1;
+inline constexpr std::size_t passed_pawn        = doubled_pawn + 1;
+inline constexpr std::size_t reachable_outpost  = passed_pawn + std::size(eval::passed_pawn);
+inline constexpr std::size_t bishop_outpost     = reachable_outpost + 1;
+inline constexpr std::size_t knight_outpost     = bishop_outpost + 1;
+inline constexpr std::size_t minor_pawn_shield  = knight_outpost + 1;
+inline constexpr std::size_t bishop_long_diag   = minor_pawn_shield + 1;
+inline constexpr std::size_t bishop_pair        = bishop_long_diag + 1;
+inline constexpr std::size_t bishop_blockers    = bishop_pair + 1;
+inline constexpr std::size_t rook_closed_file   = bishop_blockers + 1;
+inline constexpr std::size_t kingzone_xray_att  = rook_closed_file + 1;
+inline constexpr std::size_t queen_discover_att = kingzone_xray_att + 1;
+inline constexpr std::size_t rook_open_file     = queen_discover_att + 1;
+inline constexpr std::size_t pawn_shelter       = rook_open_file + std::size(eval::rook_open_file);
+inline constexpr std::size_t pawn_storm         = pawn_shelter + std::size(eval::pawn_shelter);
+inline constexpr std::size_t king_open_file =
+    pawn_storm + std::size(eval::pawn_storm) * std::size(eval::pawn_storm[0]);
+inline constexpr std::size_t king_file =
+    king_open_file + std::size(eval::king_open_file) * std::size(eval::king_open_file[0]);
+inline constexpr std::size_t weak_piece = king_file + std::size(eval::king_file);
+inline constexpr std::size_t knight_mob = weak_piece + std::size(eval::weak_piece);
+inline constexpr std::size_t bishop_mob = knight_mob + std::size(eval::knight_mob);
+inline constexpr std::size_t rook_mob   = bishop_mob + std::size(eval::bishop_mob);
+inline constexpr std::size_t queen_mob  = rook_mob + std::size(eval::rook_mob);
+inline constexpr std::size_t count      = queen_mob + std::size(eval::queen_mob);
+
+// Mobility table offset by piece type, parallel to eval::mobility.
+inline constexpr std::size_t mobility[] = {0, 0, knight_mob, bishop_mob, rook_mob, queen_mob};
+
+} // namespace parameter
+
+using ParameterVector = std::vector<TaperedScore>;
+
+// Named contiguous run of a ParameterVector, as written to parameter files.
+struct ParameterGroup {
+    std::string_view name;
+    std::size_t      offset;
+    std::size_t      size;
+};
+
+[[nodiscard]] std::span<const ParameterGroup> parameter_groups();
+
+// The weights the evaluator currently uses, indexed by eval::parameter.
+[[nodiscard]] ParameterVector current_parameters();
+
+// Parameter files hold one "group index mg eg" line per weight; '#' starts a comment. Weights
+// a file leaves out keep their current value. Throws std::runtime_error on malformed lines,
+// unknown groups and out-of-range indices.
+[[nodiscard]] ParameterVector read_parameters(std::istream& input);
+void write_parameters(std::ostream& output, const ParameterVector& weights);
+
+// Replaces the evaluator's weights. Boards keep PSQT sums computed under the old weights, so
+// callers load before setting up positions. Throws std::runtime_error unless eval::tunable.
+void apply_parameters(const ParameterVector& weights);
+void load_parameters(const std::string& path);
+
+} // namespace eval
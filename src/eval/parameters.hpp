@@ -8,8 +8,26 @@
 #include "core/square.hpp"
 #include "eval/tapered_score.hpp"
 
+#ifndef LATRUNCULI_TUNABLE_EVAL
+#define LATRUNCULI_TUNABLE_EVAL 0
+#endif
+
+// Weights covered by the tuner's parameter vector. Tunable builds keep them in mutable storage
+// so load_parameters() can replace them at startup; normal builds fold them as constants.
+// Functions that read those weights use LATRUNCULI_EVAL_FN, since mutable storage cannot be
+// read in a constant expression.
+#if LATRUNCULI_TUNABLE_EVAL
+#define LATRUNCULI_EVAL_PARAM inline
+#define LATRUNCULI_EVAL_FN    inline
+#else
+#define LATRUNCULI_EVAL_PARAM constexpr
+#define LATRUNCULI_EVAL_FN    constexpr
+#endif
+
 namespace eval {
 
+constexpr bool tunable = LATRUNCULI_TUNABLE_EVAL;
+
 enum class Phase : std::uint8_t {
     Midgame = 0,
     Endgame,
@@ -22,13 +40,17 @@ constexpr int scale_base     = 48;
 constexpr int scale_per_pawn = 4;
 constexpr int phase_limit    = 128;
 
+// Positional swing beyond material and PSQT that evaluate_lazy assumes is not exceeded. A
+// heuristic chosen above the largest swing `benchmark eval swing` measured, not a bound.
+constexpr int lazy_margin = 600;
+
 constexpr TaperedScore pawn   = {100, 166};
 constexpr TaperedScore knight = {630, 680};
 constexpr TaperedScore bishop = {660, 740};
 constexpr TaperedScore rook   = {1000, 1100};
 constexpr TaperedScore queen  = {2000, 2150};
 
-constexpr int material_mg = 4 * knight.mg + 4 * bishop.mg + 4 * rook.mg + 2 * queen.mg;
+constexpr int material_mg = 4 * knight.mg() + 4 * bishop.mg() + 4 * rook.mg() + 2 * queen.mg();
 constexpr int material_eg = 0;
 
 namespace masks {
@@ -53,7 +75,7 @@ constexpr TaperedScore pieces[N_PIECETYPES][N_COLORS] = {
     {TaperedScore::Zero, TaperedScore::Zero},
 };
 
-constexpr int piece_squares[piece_slots][2][64] = {
+LATRUNCULI_EVAL_PARAM int piece_squares[piece_slots][2][64] = {
     // clang-format off
     {
         // Pawn midgame bonuses
@@ -202,61 +224,61 @@ constexpr TaperedScore piece(PieceType pt, Color c = WHITE) {
     return pieces[pt][c];
 }
 
-constexpr TaperedScore piece_sq(PieceType pt, Color c, Square sq) {
+LATRUNCULI_EVAL_FN TaperedScore piece_sq(PieceType pt, Color c, Square sq) {
     assert(is_piece_type(pt));
     Square       relative = square::relative(sq, c);
     TaperedScore score    = {
-           .mg = piece_squares[piece_slot(pt)][std::to_underlying(Phase::Midgame)][relative],
-           .eg = piece_squares[piece_slot(pt)][std::to_underlying(Phase::Endgame)][relative]};
+        piece_squares[piece_slot(pt)][std::to_underlying(Phase::Midgame)][relative],
+        piece_squares[piece_slot(pt)][std::to_underlying(Phase::Endgame)][relative]};
 
     return (score * c * 2) - score;
 }
 
-constexpr TaperedScore iso_pawn      = {-5, -15};
-constexpr TaperedScore backward_pawn = {-10, -25};
-constexpr TaperedScore doubled_pawn  = {-10, -50};
-constexpr TaperedScore passed_pawn[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore iso_pawn      = {-5, -15};
+LATRUNCULI_EVAL_PARAM TaperedScore backward_pawn = {-10, -25};
+LATRUNCULI_EVAL_PARAM TaperedScore doubled_pawn  = {-10, -50};
+LATRUNCULI_EVAL_PARAM TaperedScore passed_pawn[] = {
     {0, 0}, {0, 0}, {5, 10}, {10, 20}, {20, 40}, {40, 80}, {80, 160}, {0, 0}};
-constexpr TaperedScore reachable_outpost  = {30, 20};
-constexpr TaperedScore bishop_outpost     = {30, 20};
-constexpr TaperedScore knight_outpost     = {50, 30};
-constexpr TaperedScore minor_pawn_shield  = {20, 5};
-constexpr TaperedScore bishop_long_diag   = {40, 0};
-constexpr TaperedScore bishop_pair        = {50, 80};
-constexpr TaperedScore bishop_blockers    = {-2, -6};
-constexpr TaperedScore rook_closed_file   = {-10, -5};
-constexpr TaperedScore kingzone_xray_att  = {20, 0};
-constexpr TaperedScore queen_discover_att = {-50, -25};
+LATRUNCULI_EVAL_PARAM TaperedScore reachable_outpost  = {30, 20};
+LATRUNCULI_EVAL_PARAM TaperedScore bishop_outpost     = {30, 20};
+LATRUNCULI_EVAL_PARAM TaperedScore knight_outpost     = {50, 30};
+LATRUNCULI_EVAL_PARAM TaperedScore minor_pawn_shield  = {20, 5};
+LATRUNCULI_EVAL_PARAM TaperedScore bishop_long_diag   = {40, 0};
+LATRUNCULI_EVAL_PARAM TaperedScore bishop_pair        = {50, 80};
+LATRUNCULI_EVAL_PARAM TaperedScore bishop_blockers    = {-2, -6};
+LATRUNCULI_EVAL_PARAM TaperedScore rook_closed_file   = {-10, -5};
+LATRUNCULI_EVAL_PARAM TaperedScore kingzone_xray_att  = {20, 0};
+LATRUNCULI_EVAL_PARAM TaperedScore queen_discover_att = {-50, -25};
 
 // bonus for rook on open files: [0 = semi-open, 1 = fully open]
-constexpr TaperedScore rook_open_file[] = {{20, 10}, {40, 20}};
+LATRUNCULI_EVAL_PARAM TaperedScore rook_open_file[] = {{20, 10}, {40, 20}};
 
 // shelter bonus for friendly pawn rank [index = pawn rank, 0 = no pawn]
-constexpr TaperedScore pawn_shelter[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore pawn_shelter[] = {
     {-30, 0}, {60, 0}, {35, 0}, {-20, 0}, {-5, 0}, {-20, 0}, {-80, 0}};
 
 // Pawn storm penalty by pawn rank:
 // [0 = unblocked, 1 = blocked][index = pawn rank, 0 = no pawn)]
-constexpr TaperedScore pawn_storm[][7] = {
+LATRUNCULI_EVAL_PARAM TaperedScore pawn_storm[][7] = {
     {{0, 0}, {-20, 0}, {-120, 0}, {-60, 0}, {-45, 0}, {-20, 0}, {-10, 0}},
     {{0, 0}, {0, 0}, {-60, -60}, {0, -20}, {5, -15}, {10, -10}, {15, -5}}};
 
 // score for king on open/closed files: [friendly file][enemy file] (0 = closed, 1 = open)
-constexpr TaperedScore king_open_file[][2] = {
+LATRUNCULI_EVAL_PARAM TaperedScore king_open_file[][2] = {
     {{20, -10}, {10, 5}},
     {{0, 0}, {-10, 5}},
 };
 
 // Bonus for king based on file [index = king file]
-constexpr TaperedScore king_file[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore king_file[] = {
     {20, 0}, {5, 0}, {-15, 0}, {-30, 0}, {-30, 0}, {-15, 0}, {5, 0}, {20, 0}};
 
 // Penalty for potentially hanging piece [index = piece type]
-constexpr TaperedScore weak_piece[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore weak_piece[] = {
     TaperedScore::Zero, TaperedScore::Zero, {-20, -10}, {-25, -15}, {-50, -25}, {-100, -50}};
 
 // Piece mobility scores (index = # of legal moves)
-constexpr TaperedScore knight_mob[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore knight_mob[] = {
     {-40, -48},
     {-32, -36},
     {-8, -20},
@@ -268,7 +290,7 @@ constexpr TaperedScore knight_mob[] = {
     {24, 16},
 };
 
-constexpr TaperedScore bishop_mob[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore bishop_mob[] = {
     {-32, -40},
     {-16, -16},
     {8, -4},
@@ -285,7 +307,7 @@ constexpr TaperedScore bishop_mob[] = {
     {64, 64},
 };
 
-constexpr TaperedScore rook_mob[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore rook_mob[] = {
     {-40, -56},
     {-16, -8},
     {0, 12},
@@ -303,7 +325,7 @@ constexpr TaperedScore rook_mob[] = {
     {44, 120},
 };
 
-constexpr TaperedScore queen_mob[] = {
+LATRUNCULI_EVAL_PARAM TaperedScore queen_mob[] = {
     {-20, -32}, {-12, -20}, {-4, -4},  {-4, 12},  {12, 24},  {16, 36},  {16, 40},
     {24, 48},   {28, 48},   {36, 60},  {40, 60},  {44, 64},  {44, 80},  {48, 80},
     {48, 88},   {48, 88},   {48, 88},  {48, 92},  {52, 96},  {56, 96},  {60, 100},
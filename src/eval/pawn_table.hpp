@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "board/castling_rights.hpp"
+#include "core/bitboard.hpp"
+#include "core/square.hpp"
+#include "core/types.hpp"
+#include "eval/tapered_score.hpp"
+
+namespace eval {
+
+// Pawn-structure terms for one pawn configuration. A default entry is exact for the pawnless
+// key 0, so empty slots need no separate validity flag.
+struct PawnEntry {
+    PositionKey  key                     = 0;
+    TaperedScore score[N_COLORS]         = {TaperedScore::Zero, TaperedScore::Zero};
+    Bitboard     pawn_attacks[N_COLORS]  = {0};
+    Bitboard     pawn_attacks2[N_COLORS] = {0};
+    Bitboard     attack_span[N_COLORS]   = {0};
+    Bitboard     passed_pawns[N_COLORS]  = {0};
+
+    // Shelter also depends on the king square and that side's castling rights; it is filled
+    // lazily by king safety and reused while both still match.
+    TaperedScore   shelter[N_COLORS]          = {TaperedScore::Zero, TaperedScore::Zero};
+    Square         shelter_king_sq[N_COLORS]  = {INVALID, INVALID};
+    CastlingRights shelter_castling[N_COLORS] = {NO_CASTLE, NO_CASTLE};
+};
+
+// Direct-mapped pawn hash owned by one search worker; pawn structure rarely changes between
+// evaluated nodes, so most lookups skip the pawn terms entirely.
+class PawnTable {
+public:
+    static constexpr std::size_t size = std::size_t{1} << 13;
+
+    PawnTable() : entries(size) {}
+
+    [[nodiscard]] PawnEntry& operator[](PositionKey pawn_key) noexcept {
+        return entries[pawn_key & (size - 1)];
+    }
+
+    void clear() { entries.assign(size, PawnEntry{}); }
+
+private:
+    std::vector<PawnEntry> entries;
+};
+
+} // namespace eval
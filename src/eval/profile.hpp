@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "eval/trace.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#ifndef LATRUNCULI_EVAL_PROFILE
+#define LATRUNCULI_EVAL_PROFILE 0
+#endif
+
+namespace eval {
+
+// Profile builds time every evaluate() term dispatch; normal builds compile the timers out.
+constexpr bool profiling = LATRUNCULI_EVAL_PROFILE;
+
+// Time-stamp counter cycles on x86, steady-clock nanoseconds elsewhere.
+#if defined(__x86_64__) || defined(__i386__)
+inline constexpr std::string_view profile_tick_unit = "tsc_cycles";
+
+inline std::uint64_t profile_ticks() noexcept {
+    return __rdtsc();
+}
+#else
+inline constexpr std::string_view profile_tick_unit = "ns";
+
+inline std::uint64_t profile_ticks() noexcept {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+#endif
+
+// Ticks and calls per term, each term's White and Black dispatches summed. Mobility and
+// threats are accumulated while the piece terms run; their rows hold that time, taken out of
+// the piece terms' rows, plus their own dispatch. Calls count dispatches only.
+struct TermProfile {
+    std::array<std::uint64_t, std::to_underlying(Term::Count)> ticks{};
+    std::array<std::uint64_t, std::to_underlying(Term::Count)> calls{};
+};
+
+// The calling thread's profile; evaluations add to it only when profiling.
+inline TermProfile& term_profile() noexcept {
+    static thread_local TermProfile profile;
+    return profile;
+}
+
+// Moves the ticks fn takes from enclosing, whose dispatch is running, to term. The enclosing
+// row may wrap below zero until its dispatch adds the whole span.
+template <Term term, Term enclosing, typename Fn>
+inline void profile_nested(Fn&& fn) {
+    const std::uint64_t start = profile_ticks();
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    fn();
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    const std::uint64_t ticks = profile_ticks() - start;
+
+    TermProfile& profile = term_profile();
+    profile.ticks[std::to_underlying(term)] += ticks;
+    profile.ticks[std::to_underlying(enclosing)] -= ticks;
+}
+
+} // namespace eval
@@ -1,15 +1,29 @@
 #pragma once
 
+#include <cstdint>
+
 #include "core/types.hpp"
 
 namespace eval {
 
-struct TaperedScore {
-    EvalValue mg = 0;
-    EvalValue eg = 0;
+// Middlegame and endgame values packed into one 64-bit word, endgame in the high half, so each
+// accumulation is a single integer add. Halves keep the full EvalValue range: the borrow a
+// negative middlegame value takes from the endgame half is undone when unpacking.
+class TaperedScore {
+public:
+    constexpr TaperedScore() = default;
+    constexpr TaperedScore(EvalValue mg, EvalValue eg)
+        : packed((std::int64_t{eg} * (std::int64_t{1} << 32)) + mg) {}
 
     static TaperedScore const Zero;
 
+    [[nodiscard]] constexpr EvalValue mg() const noexcept {
+        return EvalValue(std::uint32_t(packed));
+    }
+    [[nodiscard]] constexpr EvalValue eg() const noexcept {
+        return EvalValue((packed + (std::int64_t{1} << 31)) >> 32);
+    }
+
     constexpr TaperedScore operator+(const TaperedScore& other) const;
     constexpr TaperedScore operator-(const TaperedScore& other) const;
     constexpr TaperedScore operator*(EvalValue scalar) const;
@@ -17,52 +31,58 @@ struct TaperedScore {
     constexpr bool         operator==(const TaperedScore& other) const;
     constexpr bool         operator!=(const TaperedScore& other) const;
 
-    TaperedScore& operator+=(const TaperedScore& other);
-    TaperedScore& operator-=(const TaperedScore& other);
-    TaperedScore& operator*=(EvalValue scalar);
+    constexpr TaperedScore& operator+=(const TaperedScore& other);
+    constexpr TaperedScore& operator-=(const TaperedScore& other);
+    constexpr TaperedScore& operator*=(EvalValue scalar);
+
+private:
+    static constexpr TaperedScore from_packed(std::int64_t value) {
+        TaperedScore score;
+        score.packed = value;
+        return score;
+    }
+
+    std::int64_t packed = 0;
 };
 
 constexpr TaperedScore TaperedScore::Zero = {0, 0};
 
 constexpr TaperedScore TaperedScore::operator+(const TaperedScore& other) const {
-    return {mg + other.mg, eg + other.eg};
+    return from_packed(packed + other.packed);
 }
 
 constexpr TaperedScore TaperedScore::operator-(const TaperedScore& other) const {
-    return {mg - other.mg, eg - other.eg};
+    return from_packed(packed - other.packed);
 }
 
 constexpr TaperedScore TaperedScore::operator*(EvalValue scalar) const {
-    return {mg * scalar, eg * scalar};
+    return from_packed(packed * scalar);
 }
 
 constexpr TaperedScore TaperedScore::operator-() const {
-    return {-mg, -eg};
+    return from_packed(-packed);
 }
 
 constexpr bool TaperedScore::operator==(const TaperedScore& other) const {
-    return mg == other.mg && eg == other.eg;
+    return packed == other.packed;
 }
 
 constexpr bool TaperedScore::operator!=(const TaperedScore& other) const {
     return !(*this == other);
 }
 
-inline TaperedScore& TaperedScore::operator+=(const TaperedScore& other) {
-    mg += other.mg;
-    eg += other.eg;
+constexpr TaperedScore& TaperedScore::operator+=(const TaperedScore& other) {
+    packed += other.packed;
     return *this;
 }
 
-inline TaperedScore& TaperedScore::operator-=(const TaperedScore& other) {
-    mg -= other.mg;
-    eg -= other.eg;
+constexpr TaperedScore& TaperedScore::operator-=(const TaperedScore& other) {
+    packed -= other.packed;
     return *this;
 }
 
-inline TaperedScore& TaperedScore::operator*=(EvalValue scalar) {
-    mg *= scalar;
-    eg *= scalar;
+constexpr TaperedScore& TaperedScore::operator*=(EvalValue scalar) {
+    packed *= scalar;
     return *this;
 }
 
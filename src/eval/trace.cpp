@@ -45,6 +45,22 @@ Color Trace::side_to_move() const noexcept {
     return turn;
 }
 
+int Trace::coefficient(std::size_t parameter) const noexcept {
+    return coefficients[parameter];
+}
+
+TaperedScore Trace::fixed_score() const noexcept {
+    return fixed;
+}
+
+int Trace::phase() const noexcept {
+    return mg_phase;
+}
+
+int Trace::scale(Color color) const noexcept {
+    return scales[color];
+}
+
 void Trace::record(Term term, Color color, TaperedScore score) noexcept {
     TermScore& term_score = terms[std::to_underlying(term)];
     if (color == WHITE)
@@ -55,6 +71,20 @@ void Trace::record(Term term, Color color, TaperedScore score) noexcept {
     }
 }
 
+void Trace::add_coefficient(std::size_t parameter, int uses) noexcept {
+    coefficients[parameter] += uses;
+}
+
+void Trace::add_fixed(TaperedScore score) noexcept {
+    fixed += score;
+}
+
+void Trace::record_scaling(int phase, int white_scale, int black_scale) noexcept {
+    mg_phase      = phase;
+    scales[WHITE] = white_scale;
+    scales[BLACK] = black_scale;
+}
+
 void Trace::complete(TaperedScore unscaled,
                      TaperedScore scaled,
                      EvalValue    tapered_value,
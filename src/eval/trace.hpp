@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "core/types.hpp"
+#include "eval/parameter_vector.hpp"
 #include "eval/tapered_score.hpp"
 
 namespace eval {
@@ -51,6 +52,15 @@ public:
     [[nodiscard]] EvalValue white_value() const noexcept;
     [[nodiscard]] Color     side_to_move() const noexcept;
 
+    // Linear model of unscaled_score(): uses of each tunable weight, White minus Black, plus the
+    // material and king-danger score that no tunable weight feeds.
+    [[nodiscard]] int          coefficient(std::size_t parameter) const noexcept;
+    [[nodiscard]] TaperedScore fixed_score() const noexcept;
+
+    // Game phase and each side's endgame scale factor, as the evaluator applied them.
+    [[nodiscard]] int phase() const noexcept;
+    [[nodiscard]] int scale(Color color) const noexcept;
+
 private:
     std::array<TermScore, std::to_underlying(Term::Count)> terms{};
     TaperedScore                                           unscaled    = TaperedScore::Zero;
@@ -60,7 +70,15 @@ private:
     EvalValue                                              final_value = 0;
     Color                                                  turn        = WHITE;
 
+    std::array<std::int16_t, parameter::count> coefficients{};
+    TaperedScore                               fixed            = TaperedScore::Zero;
+    int                                        mg_phase         = 0;
+    int                                        scales[N_COLORS] = {0};
+
     void record(Term term, Color color, TaperedScore score) noexcept;
+    void add_coefficient(std::size_t parameter, int uses) noexcept;
+    void add_fixed(TaperedScore score) noexcept;
+    void record_scaling(int phase, int white_scale, int black_scale) noexcept;
     void complete(TaperedScore unscaled,
                   TaperedScore scaled,
                   EvalValue    tapered_value,
@@ -11,8 +11,8 @@ namespace {
 
 std::string format_score(TaperedScore score) {
     return std::format("{:5.2f} {:5.2f}",
-                       double(score.mg) / int(eval::pawn.mg),
-                       double(score.eg) / int(eval::pawn.mg));
+                       double(score.mg()) / int(eval::pawn.mg()),
+                       double(score.eg()) / int(eval::pawn.mg()));
 }
 
 std::string format_term(const TermScore& term) {
@@ -51,7 +51,7 @@ std::string format_trace(const Trace& trace) {
     output +=
         std::format("{:>12}{}\n\n", "Total", format_term(TermScore{.white = trace.scaled_score()}));
     output +=
-        std::format("Evaluation:\t{:.2f}\n", double(trace.white_value()) / int(eval::pawn.mg));
+        std::format("Evaluation:\t{:.2f}\n", double(trace.white_value()) / int(eval::pawn.mg()));
     return output;
 }
 
@@ -1,10 +1,25 @@
+#include <exception>
 #include <iostream>
+#include <string_view>
 
-#include "core/attacks.hpp"
+#include "eval/parameter_vector.hpp"
 #include "uci/engine.hpp"
 
-int main() {
-    attacks::init();
+int main(int argc, char* argv[]) {
+    // Tunable builds take replacement evaluation weights before any position is set up.
+    for (int index = 1; index < argc; ++index) {
+        const std::string_view argument = argv[index];
+        if (argument != "--eval-params" || index + 1 >= argc) {
+            std::cerr << "Usage: " << argv[0] << " [--eval-params PATH]\n";
+            return 1;
+        }
+        try {
+            eval::load_parameters(argv[++index]);
+        } catch (const std::exception& error) {
+            std::cerr << "Error: " << error.what() << '\n';
+            return 1;
+        }
+    }
 
     uci::Engine engine(std::cout, std::cerr, std::cin);
     engine.loop();
@@ -15,17 +15,26 @@ namespace movegen {
 
 enum class MoveGenType { NonEvasions, Noisy, Evasions, Quiet };
 
-// Color- and mode-specialized generator kept header-defined for hot-path inlining.
-template <MoveGenType Type, Color Us>
+// Pseudo-legal lists leave king safety to Board::is_legal_pseudo_move. Legal lists apply pin
+// rays, check masks, and king-danger squares while generating, so callers need no filter.
+enum class Legality { PseudoLegal, Legal };
+
+// Color- and mode-specialized generator kept header-defined for hot-path inlining. Moves are
+// appended to List, a MoveList or the picker's ScoredMoveList.
+template <MoveGenType Type,
+          Color       Us,
+          Legality    Mode = Legality::PseudoLegal,
+          typename    List = MoveList>
 class Generator {
 public:
-    Generator(const Board& board, MoveList& moves)
+    Generator(const Board& board, List& moves)
         : board(board),
           moves(moves),
           king_sq(board.king_sq(Us)),
           occupancy(board.occupancy()),
           own_pieces(board.pieces(Us)),
-          enemy_pieces(board.pieces(~Us)) {}
+          enemy_pieces(board.pieces(~Us)),
+          pinned(legal ? board.blockers(Us) & own_pieces : 0) {}
 
     // Preserve emission order because it affects downstream move ordering.
     void run() {
@@ -56,6 +65,8 @@ public:
     }
 
 private:
+    static constexpr bool legal = Mode == Legality::Legal;
+
     void emit(Square from, Square to, MoveType type = BASIC_MOVE, PieceType promotion = KNIGHT) {
         moves.add(from, to, type, promotion);
     }
@@ -76,9 +87,16 @@ private:
     template <PieceType P>
     void piece_moves(Bitboard targets) {
         Bitboard bitboard = board.pieces<P>(Us);
+        // A knight never moves along its pin ray.
+        if constexpr (legal && P == KNIGHT)
+            bitboard &= ~pinned;
 
         bb::scan<Us>(bitboard, [&](Square from) {
             Bitboard moves = attacks::piece_moves<P>(from, occupancy) & targets;
+            if constexpr (legal && P != KNIGHT) {
+                if (bb::contains(pinned, from))
+                    moves &= square::collinear(king_sq, from);
+            }
             bb::scan<Us>(moves, [&](Square to) { emit(from, to); });
         });
     }
@@ -108,34 +126,57 @@ private:
     void emit_enpassant(Bitboard pawns, Square target) {
         constexpr int offset = (Us == WHITE) ? -Delta : Delta;
 
-        if (bb::contains(attacks::pawn_shift<Delta, Us>(pawns), target))
-            emit(target + offset, target, MOVE_EP);
+        if (!bb::contains(attacks::pawn_shift<Delta, Us>(pawns), target))
+            return;
+
+        // En passant removes two pawns from their ranks; replay it rather than mask it.
+        const Square from = target + offset;
+        if constexpr (legal) {
+            if (!board.is_legal_pseudo_move(Move(from, target, MOVE_EP)))
+                return;
+        }
+        emit(from, target, MOVE_EP);
     }
 
-    // Separates promotion pawns because every promotion is noisy.
+    // Pinned pawns are generated one at a time, restricted to their pin ray.
     void pawn_moves(Bitboard targets) {
+        const Bitboard all_pawns = board.pieces<PAWN>(Us);
+
+        if constexpr (legal) {
+            pawn_moves(targets, all_pawns & ~pinned, ~Bitboard(0));
+            bb::scan<Us>(all_pawns & pinned, [&](Square from) {
+                pawn_moves(targets, bb::set(from), square::collinear(king_sq, from));
+            });
+        } else {
+            pawn_moves(targets, all_pawns, ~Bitboard(0));
+        }
+    }
+
+    // Separates promotion pawns because every promotion is noisy. Destinations outside
+    // allowed are dropped.
+    void pawn_moves(Bitboard targets, Bitboard pawns, Bitboard allowed) {
         constexpr Bitboard promotion_rank = bb::relative_rank<Us>(RANK7);
 
-        Bitboard enemies = enemy_pieces;
+        Bitboard enemies = enemy_pieces & allowed;
         if constexpr (Type == MoveGenType::Evasions)
             enemies &= targets;
 
-        const Bitboard all_pawns       = board.pieces<PAWN>(Us);
-        Bitboard       promotion_pawns = all_pawns & promotion_rank;
+        Bitboard promotion_pawns = pawns & promotion_rank;
         if constexpr (Type != MoveGenType::Quiet) {
             if (promotion_pawns)
-                pawn_promotions(targets, enemies, promotion_pawns);
+                pawn_promotions(targets, enemies, promotion_pawns, allowed);
         }
 
-        Bitboard normal_pawns = all_pawns & ~promotion_rank;
+        Bitboard normal_pawns = pawns & ~promotion_rank;
         if constexpr (Type != MoveGenType::Quiet)
             pawn_captures(targets, enemies, normal_pawns);
         if constexpr (Type != MoveGenType::Noisy)
-            pawn_pushes(targets, normal_pawns);
+            pawn_pushes(targets, normal_pawns, allowed);
     }
 
-    void pawn_promotions(Bitboard targets, Bitboard enemies, Bitboard pawns) {
-        Bitboard push_moves = attacks::pawn_shift<pawn_delta::push, Us>(pawns) & ~occupancy;
+    void pawn_promotions(Bitboard targets, Bitboard enemies, Bitboard pawns, Bitboard allowed) {
+        Bitboard push_moves =
+            attacks::pawn_shift<pawn_delta::push, Us>(pawns) & ~occupancy & allowed;
         if constexpr (Type == MoveGenType::Evasions)
             push_moves &= targets;
 
@@ -169,7 +210,7 @@ private:
         emit_enpassant<pawn_delta::right>(pawns, enpassant_target);
     }
 
-    void pawn_pushes(Bitboard targets, Bitboard pawns) {
+    void pawn_pushes(Bitboard targets, Bitboard pawns, Bitboard allowed) {
         constexpr Bitboard double_push_rank = bb::relative_rank<Us>(RANK3);
 
         Bitboard push_moves = attacks::pawn_shift<pawn_delta::push, Us>(pawns) & ~occupancy;
@@ -177,6 +218,8 @@ private:
         Bitboard double_push_moves =
             attacks::pawn_shift<pawn_delta::push, Us>(push_moves & double_push_rank) & ~occupancy;
 
+        push_moves &= allowed;
+        double_push_moves &= allowed;
         if constexpr (Type == MoveGenType::Evasions) {
             push_moves &= targets;
             double_push_moves &= targets;
@@ -188,6 +231,10 @@ private:
 
     void king_moves(Bitboard targets) {
         Bitboard moves = attacks::piece_moves<KING>(king_sq) & targets;
+        if constexpr (legal) {
+            if (moves)
+                moves &= ~king_danger();
+        }
 
         bb::scan<Us>(moves, [&](Square to) { emit(king_sq, to); });
 
@@ -213,26 +260,51 @@ private:
         return !(occupancy & castling.empty_path) && !board.any_attacked(castling.king_path, ~Us);
     }
 
+    // Squares the opponent attacks once the king steps off its square, so a king retreating
+    // along a checking ray still sees the checker.
+    Bitboard king_danger() const {
+        constexpr Color Them     = ~Us;
+        const Bitboard  kingless = occupancy ^ bb::set(king_sq);
+
+        Bitboard danger = attacks::pawn_attacks<Them>(board.pieces<PAWN>(Them))
+                        | attacks::piece_moves<KING>(board.king_sq(Them));
+        bb::scan<Them>(board.pieces<KNIGHT>(Them),
+                       [&](Square from) { danger |= attacks::piece_moves<KNIGHT>(from); });
+        bb::scan<Them>(board.pieces<BISHOP, QUEEN>(Them),
+                       [&](Square from) { danger |= attacks::piece_moves<BISHOP>(from, kingless); });
+        bb::scan<Them>(board.pieces<ROOK, QUEEN>(Them),
+                       [&](Square from) { danger |= attacks::piece_moves<ROOK>(from, kingless); });
+        return danger;
+    }
+
     const Board& board;
-    MoveList&    moves;
+    List&        moves;
     Square       king_sq;
     Bitboard     occupancy;
     Bitboard     own_pieces;
     Bitboard     enemy_pieces;
+    // Own pieces pinned to the king; always empty for pseudo-legal generation.
+    Bitboard pinned;
 };
 
-template <MoveGenType Type>
-inline MoveList generate(const Board& board) {
+// Appends to moves after any entries it already holds.
+template <MoveGenType Type, Legality Mode = Legality::PseudoLegal, typename List>
+inline void generate_into(const Board& board, List& moves) {
     // Dispatch runtime side-to-move into a color-specialized hot path.
-    MoveList moves;
     if (board.side_to_move() == WHITE)
-        Generator<Type, WHITE>(board, moves).run();
+        Generator<Type, WHITE, Mode, List>(board, moves).run();
     else
-        Generator<Type, BLACK>(board, moves).run();
+        Generator<Type, BLACK, Mode, List>(board, moves).run();
+}
+
+template <MoveGenType Type, Legality Mode = Legality::PseudoLegal>
+inline MoveList generate(const Board& board) {
+    MoveList moves;
+    generate_into<Type, Mode>(board, moves);
     return moves;
 }
 
-// Generators emit pseudo-legal candidates; callers use Board for final king-safety filtering.
+// Pseudo-legal generators; callers use Board for final king-safety filtering.
 inline MoveList generate_non_evasions(const Board& board) {
     assert(!board.is_check());
     return generate<MoveGenType::NonEvasions>(board);
@@ -257,4 +329,41 @@ inline MoveList generate_pseudo_legal(const Board& board) {
     return board.is_check() ? generate_evasions(board) : generate_non_evasions(board);
 }
 
+// Legal generators need no king-safety filtering; their list sizes are legal move counts.
+inline MoveList generate_legal_noisy(const Board& board) {
+    assert(!board.is_check());
+    return generate<MoveGenType::Noisy, Legality::Legal>(board);
+}
+
+inline MoveList generate_legal_quiet(const Board& board) {
+    assert(!board.is_check());
+    return generate<MoveGenType::Quiet, Legality::Legal>(board);
+}
+
+inline MoveList generate_legal_evasions(const Board& board) {
+    assert(board.is_check());
+    return generate<MoveGenType::Evasions, Legality::Legal>(board);
+}
+
+inline MoveList generate_legal(const Board& board) {
+    return board.is_check() ? generate_legal_evasions(board)
+                            : generate<MoveGenType::NonEvasions, Legality::Legal>(board);
+}
+
+// Appending legal generators for the picker, which scores and selects the entries in place.
+inline void generate_legal_noisy(const Board& board, ScoredMoveList& moves) {
+    assert(!board.is_check());
+    generate_into<MoveGenType::Noisy, Legality::Legal>(board, moves);
+}
+
+inline void generate_legal_quiet(const Board& board, ScoredMoveList& moves) {
+    assert(!board.is_check());
+    generate_into<MoveGenType::Quiet, Legality::Legal>(board, moves);
+}
+
+inline void generate_legal_evasions(const Board& board, ScoredMoveList& moves) {
+    assert(board.is_check());
+    generate_into<MoveGenType::Evasions, Legality::Legal>(board, moves);
+}
+
 } // namespace movegen
@@ -1,56 +1,74 @@
 #pragma once
 
-#include <array>
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
 
 #include "core/move.hpp"
 
 namespace movegen {
 
-// Fixed-capacity list of generated moves.
-class MoveList {
+// A generated move and the ordering score its consumer assigns. Generation writes a zero
+// score; the picker scores entries in place.
+struct ScoredMove {
+    Move move;
+    int  score;
+};
+
+// Fixed-capacity list of generated moves, stored bare or with a score.
+template <typename Entry>
+class BasicMoveList {
 public:
     static constexpr std::size_t capacity = 256;
 
-    MoveList() = default;
-    MoveList(const MoveList& other);
-    MoveList(MoveList&& other) noexcept;
+    BasicMoveList() noexcept {}
+    BasicMoveList(const BasicMoveList& other);
+    BasicMoveList(BasicMoveList&& other) noexcept;
 
-    MoveList& operator=(const MoveList& other);
-    MoveList& operator=(MoveList&& other) noexcept;
+    BasicMoveList& operator=(const BasicMoveList& other);
+    BasicMoveList& operator=(BasicMoveList&& other) noexcept;
 
     void add(Move move);
     void add(Square from, Square to, MoveType type = BASIC_MOVE, PieceType promotion = KNIGHT);
 
-    bool        empty() const { return last == moves.data(); }
-    std::size_t size() const { return static_cast<std::size_t>(last - moves.data()); }
+    bool        empty() const { return last == moves; }
+    std::size_t size() const { return static_cast<std::size_t>(last - moves); }
 
-    Move*       begin() { return moves.data(); }
-    const Move* begin() const { return moves.data(); }
-    Move*       end() { return last; }
-    const Move* end() const { return last; }
+    Entry*       begin() { return moves; }
+    const Entry* begin() const { return moves; }
+    Entry*       end() { return last; }
+    const Entry* end() const { return last; }
 
-    Move&       operator[](int index) { return moves[index]; }
-    const Move& operator[](int index) const { return moves[index]; }
+    Entry&       operator[](int index) { return moves[index]; }
+    const Entry& operator[](int index) const { return moves[index]; }
 
 private:
-    void copy_active_range_from(const MoveList& other);
-
-    // Fixed storage and cached end pointer; copies and moves rebind the pointer.
-    std::array<Move, capacity> moves;
-    Move*                      last{moves.data()};
+    void copy_active_range_from(const BasicMoveList& other);
+
+    // Fixed storage and cached end pointer; copies and moves rebind the pointer. The union
+    // leaves storage uninitialized, so a list costs nothing until entries are added.
+    union {
+        Entry moves[capacity];
+    };
+    Entry* last{moves};
 };
 
-inline MoveList::MoveList(const MoveList& other) {
+using MoveList       = BasicMoveList<Move>;
+using ScoredMoveList = BasicMoveList<ScoredMove>;
+
+template <typename Entry>
+inline BasicMoveList<Entry>::BasicMoveList(const BasicMoveList& other) {
     copy_active_range_from(other);
 }
 
-inline MoveList::MoveList(MoveList&& other) noexcept {
+template <typename Entry>
+inline BasicMoveList<Entry>::BasicMoveList(BasicMoveList&& other) noexcept {
     copy_active_range_from(other);
 }
 
-inline MoveList& MoveList::operator=(const MoveList& other) {
+template <typename Entry>
+inline BasicMoveList<Entry>& BasicMoveList<Entry>::operator=(const BasicMoveList& other) {
     if (this == &other)
         return *this;
 
@@ -58,7 +76,8 @@ inline MoveList& MoveList::operator=(const MoveList& other) {
     return *this;
 }
 
-inline MoveList& MoveList::operator=(MoveList&& other) noexcept {
+template <typename Entry>
+inline BasicMoveList<Entry>& BasicMoveList<Entry>::operator=(BasicMoveList&& other) noexcept {
     if (this == &other)
         return *this;
 
@@ -66,21 +85,23 @@ inline MoveList& MoveList::operator=(MoveList&& other) noexcept {
     return *this;
 }
 
-inline void MoveList::add(Move move) {
-    assert(size() < moves.size());
-    *last++ = move;
+template <typename Entry>
+inline void BasicMoveList<Entry>::add(Move move) {
+    assert(size() < capacity);
+    if constexpr (std::is_same_v<Entry, Move>)
+        std::construct_at(last++, move);
+    else
+        std::construct_at(last++, Entry{.move = move, .score = 0});
 }
 
-inline void MoveList::add(Square from, Square to, MoveType type, PieceType promotion) {
-    assert(size() < moves.size());
-    *last++ = Move(from, to, type, promotion);
+template <typename Entry>
+inline void BasicMoveList<Entry>::add(Square from, Square to, MoveType type, PieceType promotion) {
+    add(Move(from, to, type, promotion));
 }
 
-inline void MoveList::copy_active_range_from(const MoveList& other) {
-    const auto active_count = other.size();
-    for (std::size_t i = 0; i < active_count; ++i)
-        moves[i] = other.moves[i];
-    last = moves.data() + active_count;
+template <typename Entry>
+inline void BasicMoveList<Entry>::copy_active_range_from(const BasicMoveList& other) {
+    last = std::uninitialized_copy(other.begin(), other.end(), moves);
 }
 
 } // namespace movegen
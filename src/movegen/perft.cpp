@@ -1,7 +1,15 @@
 #include "movegen/perft.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "board/board.hpp"
 #include "core/constants.hpp"
@@ -11,41 +19,148 @@ namespace movegen {
 
 namespace {
 
-void validate_perft_depth(int depth) {
+void validate_perft_arguments(int depth, const PerftOptions& options) {
     if (depth < 0 || depth > engine::max_search_ply)
         throw std::invalid_argument("perft depth out of range");
+    if (options.threads < 1)
+        throw std::invalid_argument("perft threads must be positive");
+    if (options.hash_mb > std::size_t(engine::max_hash_mb))
+        throw std::invalid_argument("perft hash size out of range");
 }
 
-NodeCount perft_impl(Board& board, int depth) {
-    if (depth == 0)
-        return 1;
+// Subtree node counts keyed by position and remaining depth. A slot holds its payload and the
+// payload XORed with the key, so a slot torn by a concurrent store reads as a miss.
+class PerftTable {
+public:
+    explicit PerftTable(std::size_t megabytes) {
+        const std::size_t requested = megabytes * 1024 * 1024 / sizeof(Slot);
+        if (requested == 0)
+            return;
+
+        const std::size_t count = std::bit_floor(requested);
+        slots                   = std::make_unique<Slot[]>(count);
+        mask                    = count - 1;
+    }
+
+    bool enabled() const noexcept { return slots != nullptr; }
 
-    NodeCount nodes    = 0;
-    auto      movelist = movegen::generate_pseudo_legal(board);
+    std::optional<NodeCount> probe(PositionKey key, int depth) const noexcept {
+        const Slot&         slot    = slot_for(key, depth);
+        const std::uint64_t payload = slot.payload.load(std::memory_order_relaxed);
+        const std::uint64_t check   = slot.check.load(std::memory_order_relaxed);
+
+        if ((check ^ payload) != key || int(payload & depth_mask) != depth)
+            return std::nullopt;
+        return NodeCount(payload >> depth_bits);
+    }
 
-    for (auto& move : movelist) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
+    void store(PositionKey key, int depth, NodeCount nodes) noexcept {
+        Slot&               slot    = slot_for(key, depth);
+        const std::uint64_t payload = (std::uint64_t(nodes) << depth_bits) | std::uint64_t(depth);
 
+        slot.payload.store(payload, std::memory_order_relaxed);
+        slot.check.store(key ^ payload, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int           depth_bits = 8;
+    static constexpr std::uint64_t depth_mask = (1u << depth_bits) - 1;
+    static_assert(engine::max_search_ply <= int(depth_mask));
+
+    struct Slot {
+        std::atomic<std::uint64_t> check{0};
+        std::atomic<std::uint64_t> payload{0};
+    };
+
+    // Depth picks the slot too, so one position's counts at different depths do not collide.
+    Slot& slot_for(PositionKey key, int depth) const noexcept {
+        return slots[(key ^ (std::uint64_t(depth) * 0x9E3779B97F4A7C15ull)) & mask];
+    }
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t             mask = 0;
+};
+
+// Leaves are counted in bulk: at depth 1 the legal move count is the answer.
+NodeCount perft_impl(Board& board, int depth, PerftTable& table) {
+    const PositionKey key    = board.key();
+    const bool        hashed = depth > 1 && table.enabled();
+    if (hashed) {
+        if (const auto nodes = table.probe(key, depth))
+            return *nodes;
+    }
+
+    const MoveList movelist = movegen::generate_legal(board);
+    if (depth == 1)
+        return movelist.size();
+
+    NodeCount nodes = 0;
+    for (Move move : movelist) {
         board.make(move);
-        NodeCount count = perft_impl(board, depth - 1);
-        nodes += count;
+        nodes += perft_impl(board, depth - 1, table);
         board.unmake();
     }
 
+    if (hashed)
+        table.store(key, depth, nodes);
     return nodes;
 }
 
-} // namespace
+NodeCount perft_child(Board& board, Move move, int depth, PerftTable& table) {
+    if (depth == 1)
+        return 1;
 
-NodeCount perft(Board& board, int depth) {
-    validate_perft_depth(depth);
+    board.make(move);
+    const NodeCount nodes = perft_impl(board, depth - 1, table);
+    board.unmake();
+    return nodes;
+}
 
-    return perft_impl(board, depth);
+// Root moves are handed out one at a time because their subtrees differ widely in size. Each
+// thread works on its own copy of the board.
+void count_root_moves(Board& board, int depth, const PerftOptions& options, PerftResult& result) {
+    PerftTable        table(options.hash_mb);
+    const MoveList    movelist   = movegen::generate_legal(board);
+    const std::size_t move_count = movelist.size();
+
+    result.root_moves.resize(move_count);
+    const auto count_move = [&](Board& position, std::size_t index) {
+        const Move move          = movelist[int(index)];
+        result.root_moves[index] = {
+            .move  = move,
+            .nodes = perft_child(position, move, depth, table),
+        };
+    };
+
+    const std::size_t workers = std::min<std::size_t>(options.threads, move_count);
+    if (workers <= 1 || depth == 1) {
+        for (std::size_t index = 0; index < move_count; ++index)
+            count_move(board, index);
+    } else {
+        std::atomic<std::size_t>  next{0};
+        std::vector<std::jthread> pool;
+        pool.reserve(workers);
+        for (std::size_t worker = 0; worker < workers; ++worker) {
+            pool.emplace_back([&] {
+                Board position{board};
+                for (std::size_t index = next++; index < move_count; index = next++)
+                    count_move(position, index);
+            });
+        }
+    }
+
+    for (const auto& root_move : result.root_moves)
+        result.nodes += root_move.nodes;
 }
 
-PerftResult perft_root(Board& board, int depth) {
-    validate_perft_depth(depth);
+} // namespace
+
+NodeCount perft(Board& board, int depth, const PerftOptions& options) {
+    return perft_root(board, depth, options).nodes;
+}
+
+PerftResult perft_root(Board& board, int depth, const PerftOptions& options) {
+    validate_perft_arguments(depth, options);
 
     PerftResult result{
         .nodes      = 0,
@@ -57,19 +172,7 @@ PerftResult perft_root(Board& board, int depth) {
         return result;
     }
 
-    auto movelist = movegen::generate_pseudo_legal(board);
-
-    for (auto& move : movelist) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
-
-        board.make(move);
-        const NodeCount nodes = perft_impl(board, depth - 1);
-        result.nodes += nodes;
-        result.root_moves.push_back({.move = move, .nodes = nodes});
-        board.unmake();
-    }
-
+    count_root_moves(board, depth, options, result);
     return result;
 }
 
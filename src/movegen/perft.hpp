@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -20,8 +21,16 @@ struct PerftResult {
     std::vector<PerftRootMove> root_moves;
 };
 
-NodeCount   perft(Board& board, int depth);
-PerftResult perft_root(Board& board, int depth);
+struct PerftOptions {
+    // Threads that take root moves from a shared queue.
+    int threads = 1;
+    // Megabytes for the subtree-count table shared by all threads; zero disables it.
+    std::size_t hash_mb = 0;
+};
+
+// Leaf plies are counted from the legal move list without making the moves.
+NodeCount   perft(Board& board, int depth, const PerftOptions& options = {});
+PerftResult perft_root(Board& board, int depth, const PerftOptions& options = {});
 std::string format_perft_result(const PerftResult& result);
 
 } // namespace movegen
@@ -34,6 +34,10 @@ constexpr int FutilityMaxDepth = 3;
 constexpr int RazorMargin[]    = {0, 500, 900, 1800};
 constexpr int FutilityMargin[] = {0, 250, 400, 550};
 
+// Quiet SEE pruning defaults.
+constexpr int SeeQuietMaxDepth = 3;
+constexpr int SeeQuietMargin   = 80;
+
 // Late-move reduction defaults.
 constexpr int LmrMinDepth     = 3;
 constexpr int LmrMinMoveCount = 4;
@@ -274,7 +278,7 @@ EvalValue Worker::alphabeta(
     if (search_ply >= engine::max_search_ply) {
         increment_nodes();
         stats.node(search_ply);
-        return eval::evaluate(board);
+        return evaluate_board();
     }
 
     if (depth <= 0)
@@ -283,9 +287,12 @@ EvalValue Worker::alphabeta(
     increment_nodes();
     stats.node(search_ply);
 
-    // Step 3. Mate-distance pruning.
+    // Step 3. Mate-distance pruning and the upcoming-repetition bound: a reversible move back
+    // to an earlier position secures at least a draw.
     alpha = std::max(alpha, -eval_value::mate + search_ply);
     beta  = std::min(beta, eval_value::mate - search_ply - 1);
+    if (alpha < eval_value::draw && board.has_game_cycle(search_ply))
+        alpha = eval_value::draw;
     if (alpha >= beta)
         return alpha;
 
@@ -309,13 +316,17 @@ EvalValue Worker::alphabeta(
         tt_move = record.move;
     }
 
-    const bool  in_check = board.is_check();
-    const Color side     = board.side_to_move();
-    bool        futility = false;
+    const bool  in_check          = board.is_check();
+    const Color side              = board.side_to_move();
+    bool        futility          = false;
+    bool        see_quiet_pruning = false;
+    EvalValue   static_eval       = eval_value::none;
 
     if constexpr (Node == NodeType::NonPv) {
-        // Step 5. Razoring.
-        const EvalValue static_eval = eval::evaluate(board);
+        // Step 5. Razoring. Reuse the TT's cached static eval when the probe supplied one.
+        if (!in_check)
+            static_eval = tt_record && tt_record->has_static_eval() ? tt_record->static_eval
+                                                                    : evaluate_board();
         if (can_null && !in_check && depth <= RazorMaxDepth && tt_move.is_null()
             && static_eval + RazorMargin[depth] <= alpha) {
             stats.razor_try(search_ply);
@@ -336,9 +347,10 @@ EvalValue Worker::alphabeta(
                                 && tt_record->bound == TTBound::UpperBound
                                 && tt_record->score_at_ply(search_ply) < beta;
         if (can_null && !in_check && depth >= reduction
-            && board.non_pawn_material(side) > eval::piece(ROOK).mg && !tt_upper_veto) {
+            && board.non_pawn_material(side) > eval::piece(ROOK).mg() && !tt_upper_veto) {
             stats.null_move_try(search_ply);
 
+            tt.prefetch(board.key_after(NULL_MOVE));
             board.make_null();
             ++search_ply;
             const EvalValue value =
@@ -354,9 +366,11 @@ EvalValue Worker::alphabeta(
             }
         }
 
-        // Prepare shallow futility pruning. The move loop performs the actual skip.
+        // Prepare shallow futility and quiet SEE pruning. The move loop performs the skips.
         futility = depth <= FutilityMaxDepth && !in_check && alpha > -eval_value::mate_bound
                 && alpha < eval_value::mate_bound && static_eval + FutilityMargin[depth] <= alpha;
+        see_quiet_pruning =
+            depth <= SeeQuietMaxDepth && !in_check && alpha > -eval_value::mate_bound;
     }
 
     // Step 7. Move ordering and quiet-malus tracking.
@@ -377,9 +391,7 @@ EvalValue Worker::alphabeta(
 
     // Step 8. Move loop.
     for (Move move = picker.next(); !move.is_null(); move = picker.next()) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
-
+        assert(board.is_legal_move(move));
         ++move_count;
         const bool first_legal = move_count == 1;
 
@@ -387,20 +399,30 @@ EvalValue Worker::alphabeta(
         const bool is_capture   = board.is_capture(move);
         const bool is_quiet     = !is_capture && !is_promotion;
         const bool is_killer    = is_quiet && ordering_state.is_killer(move, search_ply);
-        board.make(move);
-        ++search_ply;
+        const bool gives_check  = board.gives_check(move);
 
-        const bool gives_check = board.is_check();
+        // Step 9. Futility pruning, decided before the move is made.
         if (futility && !first_legal && is_quiet && !gives_check) {
-            // Step 9. Futility pruning.
-            board.unmake();
-            --search_ply;
             picker.skip_quiet_moves();
             stats.futility_skip(search_ply);
             continue;
         }
 
-        // Step 10. Late-move reductions.
+        // Step 10. SEE pruning. Skip quiets that hand the opponent more material than a margin
+        // growing with the square of the depth.
+        if (see_quiet_pruning && !first_legal && is_quiet && !gives_check
+            && !board.see_ge(move, -SeeQuietMargin * depth * depth)) {
+            stats.see_skip(search_ply);
+            continue;
+        }
+
+        // Overlap the child's TT cache miss with make() and its tactical refresh.
+        tt.prefetch(board.key_after(move));
+        board.make(move);
+        ++search_ply;
+        assert(gives_check == board.is_check());
+
+        // Step 11. Late-move reductions.
         // If the reduced search beats alpha, research the move at full depth.
         EvalValue value;
         const int reduction = lmr_reduction<Node>(
@@ -421,7 +443,7 @@ EvalValue Worker::alphabeta(
                 }
             }
         } else {
-            // Step 11. Principal variation search.
+            // Step 12. Principal variation search.
             if constexpr (Node == NodeType::NonPv) {
                 value = -alphabeta<NodeType::NonPv>(-beta, -alpha, depth - 1, nullptr, true);
             } else if (move_count == 1) {
@@ -445,7 +467,7 @@ EvalValue Worker::alphabeta(
             return alpha;
 
         if (value >= beta) {
-            // Step 12. Beta cutoff.
+            // Step 13. Beta cutoff.
             if (is_quiet) {
                 stats.quiet_cutoff(depth);
                 ordering_state.update_quiet_refutations(context, move, search_ply);
@@ -463,7 +485,14 @@ EvalValue Worker::alphabeta(
                 pv->update(move, child_pv);
 
             stats.beta_cutoff(search_ply, move_count);
-            tt.store(position_key, move, value, depth, TTBound::LowerBound, search_ply);
+            tt.store(position_key,
+                     move,
+                     value,
+                     depth,
+                     TTBound::LowerBound,
+                     search_ply,
+                     static_eval,
+                     Node == NodeType::Pv);
             return value;
         }
 
@@ -471,7 +500,7 @@ EvalValue Worker::alphabeta(
             if (failed_quiets.add(move))
                 stats.quiet_malus_failed_quiet(depth);
         }
-        // Step 13. Best-move update.
+        // Step 14. Best-move update.
         if (value > best_value) {
             best_value = value;
             best_move  = move;
@@ -484,20 +513,29 @@ EvalValue Worker::alphabeta(
         }
     }
 
-    // Step 14. Mate and stalemate.
+    // Step 15. Mate and stalemate.
     if (move_count == 0) {
         best_value = in_check ? -eval_value::mate + search_ply : eval_value::draw;
-        tt.store(position_key, NULL_MOVE, best_value, depth, TTBound::Exact, search_ply);
+        tt.store(position_key,
+                 NULL_MOVE,
+                 best_value,
+                 depth,
+                 TTBound::Exact,
+                 search_ply,
+                 static_eval,
+                 Node == NodeType::Pv);
         return best_value;
     }
 
-    // Step 15. TT store.
+    // Step 16. TT store.
     tt.store(position_key,
              best_move,
              best_value,
              depth,
              tt_bound_for_window(best_value, original_alpha, beta),
-             search_ply);
+             search_ply,
+             static_eval,
+             Node == NodeType::Pv);
 
     return best_value;
 }
@@ -517,17 +555,24 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
     increment_nodes();
     stats.qnode(search_ply);
 
-    // Step 2. Draw and max-ply exits.
+    // Step 2. Draw, max-ply, and upcoming-repetition exits.
     if (board.is_draw(search_ply))
         return eval_value::draw;
 
     if (search_ply >= engine::max_search_ply)
-        return eval::evaluate(board);
+        return evaluate_board();
+
+    if (alpha < eval_value::draw && board.has_game_cycle(search_ply)) {
+        alpha = eval_value::draw;
+        if (alpha >= beta)
+            return alpha;
+    }
 
     constexpr int     qsearch_tt_depth = 0;
     const EvalValue   original_alpha   = alpha;
     const PositionKey position_key     = board.key();
     Move              tt_move          = NULL_MOVE;
+    EvalValue         tt_static_eval   = eval_value::none;
 
     // Step 3. TT probe.
     stats.q_tt_probe(search_ply);
@@ -540,24 +585,36 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
             return tt_score;
         }
 
-        tt_move = record->move;
+        tt_move        = record->move;
+        tt_static_eval = record->static_eval;
     }
 
-    const bool in_check   = board.is_check();
-    int        move_count = 0;
-    EvalValue  best_value = -eval_value::inf;
-    Move       best_move  = NULL_MOVE;
+    const bool in_check    = board.is_check();
+    int        move_count  = 0;
+    EvalValue  best_value  = -eval_value::inf;
+    Move       best_move   = NULL_MOVE;
+    EvalValue  static_eval = eval_value::none;
 
-    // Step 4. Stand pat.
+    // Step 4. Stand pat. A lazy estimate only decides the cutoff; it is never stored as the
+    // static evaluation.
     if (!in_check) {
-        best_value = eval::evaluate(board);
+        if (tt_static_eval != eval_value::none) {
+            static_eval = tt_static_eval;
+            best_value  = static_eval;
+        } else {
+            const eval::CachedEvaluation stand_pat = lazy_evaluate_board(alpha, beta);
+            static_eval = stand_pat.exact ? stand_pat.value : eval_value::none;
+            best_value  = stand_pat.value;
+        }
         if (best_value >= beta) {
             tt.store(position_key,
                      NULL_MOVE,
                      best_value,
                      qsearch_tt_depth,
                      TTBound::LowerBound,
-                     search_ply);
+                     search_ply,
+                     static_eval,
+                     Node == NodeType::Pv);
             return best_value;
         }
         if (best_value > alpha)
@@ -569,11 +626,10 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
 
     // Step 5. Tactical move or evasion loop.
     for (Move move = picker.next(); !move.is_null(); move = picker.next()) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
-
+        assert(board.is_legal_move(move));
         ++move_count;
 
+        tt.prefetch(board.key_after(move));
         board.make(move);
         ++search_ply;
         const EvalValue value = -quiescence<Node>(-beta, -alpha, pv ? &child_pv : nullptr);
@@ -588,7 +644,14 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
             if (pv)
                 pv->update(move, child_pv);
             stats.beta_cutoff(search_ply, move_count);
-            tt.store(position_key, move, value, qsearch_tt_depth, TTBound::LowerBound, search_ply);
+            tt.store(position_key,
+                     move,
+                     value,
+                     qsearch_tt_depth,
+                     TTBound::LowerBound,
+                     search_ply,
+                     static_eval,
+                     Node == NodeType::Pv);
             return value;
         }
 
@@ -607,7 +670,14 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
     // Step 8. Checkmate.
     if (in_check && move_count == 0) {
         best_value = -eval_value::mate + search_ply;
-        tt.store(position_key, NULL_MOVE, best_value, qsearch_tt_depth, TTBound::Exact, search_ply);
+        tt.store(position_key,
+                 NULL_MOVE,
+                 best_value,
+                 qsearch_tt_depth,
+                 TTBound::Exact,
+                 search_ply,
+                 static_eval,
+                 Node == NodeType::Pv);
         return best_value;
     }
 
@@ -617,7 +687,9 @@ EvalValue Worker::quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation
              best_value,
              qsearch_tt_depth,
              tt_bound_for_window(best_value, original_alpha, beta),
-             search_ply);
+             search_ply,
+             static_eval,
+             Node == NodeType::Pv);
 
     return best_value;
 }
@@ -61,12 +61,16 @@ Instrumentation<true>& Instrumentation<true>::operator+=(const Instrumentation&
         counters.razor_tries[i] += other.counters.razor_tries[i];
         counters.razor_cutoffs[i] += other.counters.razor_cutoffs[i];
         counters.futility_skips[i] += other.counters.futility_skips[i];
+        counters.see_skips[i] += other.counters.see_skips[i];
         counters.lmr_tries[i] += other.counters.lmr_tries[i];
         counters.lmr_researches[i] += other.counters.lmr_researches[i];
         counters.quiet_cutoffs[i] += other.counters.quiet_cutoffs[i];
         counters.quiet_malus_eligible_nodes[i] += other.counters.quiet_malus_eligible_nodes[i];
         counters.quiet_malus_failed_quiets[i] += other.counters.quiet_malus_failed_quiets[i];
         counters.quiet_malus_updates[i] += other.counters.quiet_malus_updates[i];
+        counters.eval_cache_hits[i] += other.counters.eval_cache_hits[i];
+        counters.eval_cache_misses[i] += other.counters.eval_cache_misses[i];
+        counters.lazy_eval_exits[i] += other.counters.lazy_eval_exits[i];
     }
 
     counters.aspiration_fail_lows += other.counters.aspiration_fail_lows;
@@ -98,14 +102,16 @@ std::string Instrumentation<true>::str() const {
     const std::uint64_t razor_tries    = sum(counters.razor_tries);
     const std::uint64_t razor_cutoffs  = sum(counters.razor_cutoffs);
     const std::uint64_t futility_skips = sum(counters.futility_skips);
+    const std::uint64_t see_skips      = sum(counters.see_skips);
 
     out = std::format_to(out,
                          "RazorFutility: razor-tries={} razor-cutoffs={} "
-                         "razor-cutoff-rate={:.1f}% futility-skips={}\n",
+                         "razor-cutoff-rate={:.1f}% futility-skips={} see-skips={}\n",
                          razor_tries,
                          razor_cutoffs,
                          percentage(razor_cutoffs, razor_tries),
-                         futility_skips);
+                         futility_skips,
+                         see_skips);
 
     const std::uint64_t lmr_tries      = sum(counters.lmr_tries);
     const std::uint64_t lmr_researches = sum(counters.lmr_researches);
@@ -116,6 +122,20 @@ std::string Instrumentation<true>::str() const {
                          lmr_researches,
                          percentage(lmr_researches, lmr_tries));
 
+    const std::uint64_t eval_cache_hits   = sum(counters.eval_cache_hits);
+    const std::uint64_t eval_cache_misses = sum(counters.eval_cache_misses);
+    const std::uint64_t lazy_eval_exits   = sum(counters.lazy_eval_exits);
+
+    out = std::format_to(out,
+                         "EvalCache: hits={} misses={} hit-rate={:.1f}%\n",
+                         eval_cache_hits,
+                         eval_cache_misses,
+                         percentage(eval_cache_hits, eval_cache_hits + eval_cache_misses));
+    out = std::format_to(out,
+                         "LazyEval: exits={} miss-exit-rate={:.1f}%\n",
+                         lazy_eval_exits,
+                         percentage(lazy_eval_exits, eval_cache_misses));
+
     const std::uint64_t quiet_cutoffs              = sum(counters.quiet_cutoffs);
     const std::uint64_t quiet_malus_eligible_nodes = sum(counters.quiet_malus_eligible_nodes);
     const std::uint64_t quiet_malus_failed_quiets  = sum(counters.quiet_malus_failed_quiets);
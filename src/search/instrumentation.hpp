@@ -39,12 +39,16 @@ struct Counters {
     CounterArray razor_tries{0};
     CounterArray razor_cutoffs{0};
     CounterArray futility_skips{0};
+    CounterArray see_skips{0};
     CounterArray lmr_tries{0};
     CounterArray lmr_researches{0};
     CounterArray quiet_cutoffs{0};
     CounterArray quiet_malus_eligible_nodes{0};
     CounterArray quiet_malus_failed_quiets{0};
     CounterArray quiet_malus_updates{0};
+    CounterArray eval_cache_hits{0};
+    CounterArray eval_cache_misses{0};
+    CounterArray lazy_eval_exits{0};
 
     std::uint64_t aspiration_fail_lows{0};
     std::uint64_t aspiration_fail_highs{0};
@@ -74,12 +78,16 @@ public:
     void        razor_try(int) {}
     void        razor_cutoff(int) {}
     void        futility_skip(int) {}
+    void        see_skip(int) {}
     void        lmr_try(int) {}
     void        lmr_research(int) {}
     void        quiet_cutoff(int) {}
     void        quiet_malus_eligible_node(int) {}
     void        quiet_malus_failed_quiet(int) {}
     void        quiet_malus_update(int) {}
+    void        eval_cache_hit(int) {}
+    void        eval_cache_miss(int) {}
+    void        lazy_eval_exit(int) {}
     std::string str() const { return {}; }
 
     Instrumentation& operator+=(const Instrumentation&) { return *this; }
@@ -184,6 +192,11 @@ public:
             counters.futility_skips[ply]++;
     }
 
+    void see_skip(const int ply) {
+        if (valid_index(ply))
+            counters.see_skips[ply]++;
+    }
+
     void lmr_try(const int ply) {
         if (valid_index(ply))
             counters.lmr_tries[ply]++;
@@ -214,6 +227,21 @@ public:
             counters.quiet_malus_updates[depth]++;
     }
 
+    void eval_cache_hit(const int ply) {
+        if (valid_index(ply))
+            counters.eval_cache_hits[ply]++;
+    }
+
+    void eval_cache_miss(const int ply) {
+        if (valid_index(ply))
+            counters.eval_cache_misses[ply]++;
+    }
+
+    void lazy_eval_exit(const int ply) {
+        if (valid_index(ply))
+            counters.lazy_eval_exits[ply]++;
+    }
+
     Instrumentation& operator+=(const Instrumentation& other);
 
     const Counters& raw_counters() const { return counters; }
@@ -87,10 +87,7 @@ bool Picker::is_quiet_hint(Move move) const {
 }
 
 Move Picker::validate_tt_hint(Move move) const {
-    if (move.is_null() || !board.is_pseudo_legal(move))
-        return NULL_MOVE;
-
-    if (in_check && !board.is_legal_pseudo_move(move))
+    if (move.is_null() || !board.is_pseudo_legal(move) || !board.is_legal_pseudo_move(move))
         return NULL_MOVE;
 
     if (mode == Mode::QSearch && !in_check && move.type() != MOVE_PROM && !board.is_capture(move))
@@ -103,7 +100,8 @@ Move Picker::validate_quiet_hint(Move move) const {
     if (move.is_null() || is_quiet_hint(move) || is_tt_move(move))
         return NULL_MOVE;
 
-    if (move.type() == MOVE_PROM || board.is_capture(move) || !board.is_pseudo_legal(move))
+    if (move.type() == MOVE_PROM || board.is_capture(move) || !board.is_pseudo_legal(move)
+        || !board.is_legal_pseudo_move(move))
         return NULL_MOVE;
 
     return move;
@@ -122,12 +120,14 @@ int Picker::score_noisy(Move move) const {
     if (move.type() == MOVE_PROM)
         return PromotionScore;
 
-    const int see_score = board.see(move);
-    if (see_score < 0)
+    // Captures that keep the whole victim rank ahead of those the exchange pays back.
+    const int victim_value = eval::piece(board.captured_piece_type(move)).mg();
+    if (board.see_ge(move, victim_value))
+        return GoodCaptureScoreBase + CaptureVictimWeight * victim_value + victim_value;
+    if (!board.see_ge(move, 0))
         return WeakCaptureScore;
 
-    const int victim_value = eval::piece(board.captured_piece_type(move)).mg;
-    return GoodCaptureScoreBase + CaptureVictimWeight * victim_value + see_score;
+    return GoodCaptureScoreBase + CaptureVictimWeight * victim_value;
 }
 
 template <Picker::ScorePolicy Policy>
@@ -145,18 +145,9 @@ int Picker::score_move(Move move) const {
 }
 
 template <Picker::ScorePolicy Policy>
-Picker::Candidate* Picker::score_moves(const movegen::MoveList& list, Candidate* out) {
-    Candidate*       cur   = out;
-    Candidate* const limit = candidates.data() + candidates.size();
-
-    for (Move move : list) {
-        assert(cur < limit);
-        cur->move  = move;
-        cur->score = score_move<Policy>(move);
-        ++cur;
-    }
-
-    return cur;
+void Picker::score_moves(CandidateRange range) {
+    for (Candidate* candidate = range.next; candidate != range.end; ++candidate)
+        candidate->score = score_move<Policy>(candidate->move);
 }
 
 template <Picker::PickPolicy Policy>
@@ -228,13 +219,11 @@ Move Picker::next() {
             break;
 
         case Stage::LoadEvasions: {
-            primary_range.next                    = candidates.data();
-            const movegen::MoveList evasion_moves = movegen::generate_evasions(board);
-            primary_range.end =
-                score_moves<ScorePolicy::Evasion>(evasion_moves, primary_range.next);
-            quiet_range.next = primary_range.end;
-            quiet_range.end  = primary_range.end;
-            stage            = Stage::PickEvasion;
+            movegen::generate_legal_evasions(board, candidates);
+            primary_range = {.next = candidates.begin(), .end = candidates.end()};
+            quiet_range   = {.next = primary_range.end, .end = primary_range.end};
+            score_moves<ScorePolicy::Evasion>(primary_range);
+            stage = Stage::PickEvasion;
             [[fallthrough]];
         }
 
@@ -247,12 +236,11 @@ Move Picker::next() {
         }
 
         case Stage::LoadNoisy: {
-            primary_range.next                  = candidates.data();
-            const movegen::MoveList noisy_moves = movegen::generate_noisy(board);
-            primary_range.end = score_moves<ScorePolicy::Noisy>(noisy_moves, primary_range.next);
-            quiet_range.next  = primary_range.end;
-            quiet_range.end   = primary_range.end;
-            stage             = Stage::PickGoodNoisy;
+            movegen::generate_legal_noisy(board, candidates);
+            primary_range = {.next = candidates.begin(), .end = candidates.end()};
+            quiet_range   = {.next = primary_range.end, .end = primary_range.end};
+            score_moves<ScorePolicy::Noisy>(primary_range);
+            stage = Stage::PickGoodNoisy;
             [[fallthrough]];
         }
 
@@ -281,11 +269,12 @@ Move Picker::next() {
                 stage = Stage::PickBadNoisy;
                 break;
             }
-            assert(primary_range.end != nullptr);
-            quiet_range.next                    = primary_range.end;
-            const movegen::MoveList quiet_moves = movegen::generate_quiet(board);
-            quiet_range.end = score_moves<ScorePolicy::Quiet>(quiet_moves, quiet_range.next);
-            stage           = Stage::PickQuiet;
+            // Quiet moves land right after the noisy ones, which stay pickable as bad noisy.
+            assert(primary_range.end == candidates.end());
+            movegen::generate_legal_quiet(board, candidates);
+            quiet_range = {.next = primary_range.end, .end = candidates.end()};
+            score_moves<ScorePolicy::Quiet>(quiet_range);
+            stage = Stage::PickQuiet;
             [[fallthrough]];
         }
 
@@ -26,7 +26,7 @@ public:
 
     static Picker for_quiescence(const Board& board, const State& state, Move tt_move = NULL_MOVE);
 
-    // Returns ordered pseudo-legal candidates; search remains the legal-move authority.
+    // Returns ordered legal moves: generated lists are legal and hints are validated.
     Move next();
     void skip_quiet_moves();
 
@@ -62,11 +62,9 @@ private:
         BadNoisy,
     };
 
-    struct Candidate {
-        Move move;
-        int  score;
-    };
+    using Candidate = movegen::ScoredMove;
 
+    // A stage's slice of the generated list; picked candidates are swapped to its front.
     struct CandidateRange {
         Candidate* next{nullptr};
         Candidate* end{nullptr};
@@ -94,21 +92,22 @@ private:
     int score_noisy(Move move) const;
 
     template <ScorePolicy Policy>
-    Candidate* score_moves(const movegen::MoveList& list, Candidate* out);
+    void score_moves(CandidateRange range);
 
     template <PickPolicy Policy>
     bool is_pickable(const Candidate& candidate) const;
     template <PickPolicy Policy>
     Move pick(CandidateRange& range);
 
-    const Board&                                       board;
-    const State&                                       state;
-    const State::Context                               context;
-    Move                                               tt_move{NULL_MOVE};
-    const Mode                                         mode;
-    const bool                                         in_check;
-    Stage                                              stage{Stage::TtMove};
-    std::array<Candidate, movegen::MoveList::capacity> candidates;
+    const Board&         board;
+    const State&         state;
+    const State::Context context;
+    Move                 tt_move{NULL_MOVE};
+    const Mode           mode;
+    const bool           in_check;
+    Stage                stage{Stage::TtMove};
+    // Generated in place: evasions, or noisy moves followed by quiet moves.
+    movegen::ScoredMoveList candidates;
     // Holds evasions when in check, otherwise noisy moves.
     CandidateRange                      primary_range;
     CandidateRange                      quiet_range;
@@ -5,8 +5,8 @@
 
 namespace search {
 
-Thread::Thread(int id, Reporter& reporter, ThreadPool& pool)
-    : worker(id, reporter, pool),
+Thread::Thread(int id, Reporter& reporter, TranspositionTable& tt, ThreadPool& pool)
+    : worker(id, reporter, tt, pool),
       native_thread(&Thread::idle_loop, this) {}
 
 Thread::~Thread() {
@@ -87,11 +87,13 @@ void Thread::wake_for_search() {
     state_cv.notify_one();
 }
 
-ThreadPool::ThreadPool(size_t thread_count, Reporter& reporter) : reporter(reporter) {
+ThreadPool::ThreadPool(size_t thread_count, Reporter& reporter, TranspositionTable& tt)
+    : reporter(reporter),
+      tt(tt) {
     threads.reserve(thread_count);
     for (size_t i = 0; i < thread_count; ++i) {
         threads.push_back(
-            std::unique_ptr<Thread>{new Thread(static_cast<int>(i), reporter, *this)});
+            std::unique_ptr<Thread>{new Thread(static_cast<int>(i), reporter, tt, *this)});
     }
 }
 
@@ -185,10 +187,12 @@ bool ThreadPool::resize(size_t thread_count) {
         additions.reserve(thread_count - installed_count);
         for (size_t i = installed_count; i < thread_count; ++i)
             additions.push_back(
-                std::unique_ptr<Thread>{new Thread(static_cast<int>(i), reporter, *this)});
+                std::unique_ptr<Thread>{new Thread(static_cast<int>(i), reporter, tt, *this)});
 
-        for (auto& thread : additions)
+        for (auto& thread : additions) {
+            thread->worker.set_network(network);
             threads.push_back(std::move(thread));
+        }
     }
 
     return true;
@@ -198,6 +202,14 @@ size_t ThreadPool::thread_count() const {
     return threads.size();
 }
 
+void ThreadPool::set_network(const eval::nnue::Network* new_network) {
+    assert(!is_searching());
+
+    network = new_network;
+    for (auto& thread : threads)
+        thread->worker.set_network(network);
+}
+
 // Search progress and results.
 bool ThreadPool::is_searching() const {
     auto is_searching = [](const auto& thread) { return thread->is_searching(); };
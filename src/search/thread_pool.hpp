@@ -20,6 +20,7 @@ class SearchThreadTestAccess;
 namespace search {
 
 class ThreadPool;
+class TranspositionTable;
 
 // Native thread wrapper. Owns a Worker and OS thread.
 class Thread {
@@ -32,7 +33,7 @@ public:
     Thread& operator=(Thread&&)      = delete;
 
 private:
-    Thread(int id, Reporter& reporter, ThreadPool& pool);
+    Thread(int id, Reporter& reporter, TranspositionTable& tt, ThreadPool& pool);
 
     // ThreadPool-facing lifecycle.
     void request_stop();
@@ -65,7 +66,7 @@ private:
 class ThreadPool {
 public:
     ThreadPool() = delete;
-    ThreadPool(size_t thread_count, Reporter& reporter);
+    ThreadPool(size_t thread_count, Reporter& reporter, TranspositionTable& tt);
     ~ThreadPool();
     ThreadPool(const ThreadPool&)            = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
@@ -83,6 +84,7 @@ public:
     // Worker configuration.
     bool   resize(size_t thread_count);
     size_t thread_count() const;
+    void   set_network(const eval::nnue::Network* network);
 
     // Search progress and results.
     bool      is_searching() const;
@@ -99,6 +101,14 @@ private:
     // the entire lifetime of the pool and its workers.
     Reporter& reporter;
 
+    // Non-owning table shared by every worker. The owner keeps it alive for the pool's
+    // lifetime and only resizes or clears it while the pool is idle.
+    TranspositionTable& tt;
+
+    // Non-owning network shared by every worker, or null for the handcrafted evaluator. The
+    // owner keeps it alive until replacing it while the pool is idle.
+    const eval::nnue::Network* network = nullptr;
+
     // Pool lifecycle state.
     bool shutdown_requested{false};
 
@@ -1,71 +1,122 @@
 #include "search/tt.hpp"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace search {
 
 namespace {
-constexpr int tt_score_bits      = 16;
-constexpr int tt_move_bits       = 16;
-constexpr int tt_depth_bits      = 8;
-constexpr int tt_generation_bits = 8;
-constexpr int tt_bound_bits      = 8;
-
-constexpr int tt_move_shift       = 0;
-constexpr int tt_score_shift      = tt_move_shift + tt_move_bits;
-constexpr int tt_depth_shift      = tt_score_shift + tt_score_bits;
-constexpr int tt_generation_shift = tt_depth_shift + tt_depth_bits;
-constexpr int tt_bound_shift      = tt_generation_shift + tt_generation_bits;
-
-constexpr std::uint64_t tt_move_mask       = (std::uint64_t{1} << tt_move_bits) - 1;
-constexpr std::uint64_t tt_score_mask      = (std::uint64_t{1} << tt_score_bits) - 1;
-constexpr std::uint64_t tt_depth_mask      = (std::uint64_t{1} << tt_depth_bits) - 1;
-constexpr std::uint64_t tt_generation_mask = (std::uint64_t{1} << tt_generation_bits) - 1;
-constexpr std::uint64_t tt_bound_mask      = (std::uint64_t{1} << tt_bound_bits) - 1;
-constexpr std::uint64_t tt_signature_salt  = 0x9e3779b97f4a7c15ull;
+constexpr int tt_move_bits        = 16;
+constexpr int tt_score_bits       = 16;
+constexpr int tt_static_eval_bits = 16;
+constexpr int tt_depth_bits       = 8;
+constexpr int tt_bound_bits       = 2;
+constexpr int tt_pv_bits          = 1;
+constexpr int tt_generation_bits  = 5;
+
+constexpr int tt_move_shift        = 0;
+constexpr int tt_score_shift       = tt_move_shift + tt_move_bits;
+constexpr int tt_static_eval_shift = tt_score_shift + tt_score_bits;
+constexpr int tt_depth_shift       = tt_static_eval_shift + tt_static_eval_bits;
+constexpr int tt_bound_shift       = tt_depth_shift + tt_depth_bits;
+constexpr int tt_pv_shift          = tt_bound_shift + tt_bound_bits;
+constexpr int tt_generation_shift  = tt_pv_shift + tt_pv_bits;
+
+static_assert(tt_generation_shift + tt_generation_bits == 64);
+static_assert(tt_generation_cycle == 1 << tt_generation_bits);
+
+constexpr std::uint64_t tt_move_mask        = (std::uint64_t{1} << tt_move_bits) - 1;
+constexpr std::uint64_t tt_score_mask       = (std::uint64_t{1} << tt_score_bits) - 1;
+constexpr std::uint64_t tt_static_eval_mask = (std::uint64_t{1} << tt_static_eval_bits) - 1;
+constexpr std::uint64_t tt_depth_mask       = (std::uint64_t{1} << tt_depth_bits) - 1;
+constexpr std::uint64_t tt_bound_mask       = (std::uint64_t{1} << tt_bound_bits) - 1;
+constexpr std::uint64_t tt_pv_mask          = (std::uint64_t{1} << tt_pv_bits) - 1;
+constexpr std::uint64_t tt_generation_mask  = (std::uint64_t{1} << tt_generation_bits) - 1;
+constexpr std::uint64_t tt_signature_salt   = 0x9e3779b97f4a7c15ull;
+
+// Smallest slice worth handing to a clearing thread (1 MB of clusters).
+constexpr std::size_t tt_min_clear_slice = (std::size_t{1} << 20) / sizeof(TTCluster);
+
+// Hash files start with this header, padded to a cache line so mapped clusters stay aligned.
+struct TTFileHeader {
+    std::array<char, 8> magic;
+    std::uint32_t       version;
+    std::uint32_t       cluster_bytes;
+    std::uint64_t       cluster_count;
+    std::uint64_t       evaluator;
+    std::uint8_t        generation;
+    std::uint8_t        reserved[31];
+};
+static_assert(sizeof(TTFileHeader) == 64);
+
+constexpr std::array<char, 8> tt_file_magic   = {'L', 'A', 'T', 'R', 'T', 'T', '\0', '\0'};
+constexpr std::uint32_t       tt_file_version = 2;
 
 struct TTSnapshot {
-    PositionKey key = 0;
-    TTRecord    record{};
+    std::uint32_t key_fragment = 0;
+    TTRecord      record{};
 };
 
 [[nodiscard]] std::uint64_t pack_payload(const TTRecord& record) {
-    const auto packed_score = std::bit_cast<std::uint16_t>(record.score);
+    const auto packed_score       = std::bit_cast<std::uint16_t>(record.score);
+    const auto packed_static_eval = std::bit_cast<std::uint16_t>(record.static_eval);
 
     return (std::uint64_t(record.move.bits) << tt_move_shift)
          | ((std::uint64_t(packed_score) & tt_score_mask) << tt_score_shift)
+         | ((std::uint64_t(packed_static_eval) & tt_static_eval_mask) << tt_static_eval_shift)
          | ((std::uint64_t(record.depth) & tt_depth_mask) << tt_depth_shift)
-         | ((std::uint64_t(record.generation) & tt_generation_mask) << tt_generation_shift)
-         | ((std::uint64_t(std::to_underlying(record.bound)) & tt_bound_mask) << tt_bound_shift);
+         | ((std::uint64_t(std::to_underlying(record.bound)) & tt_bound_mask) << tt_bound_shift)
+         | ((std::uint64_t(record.pv) & tt_pv_mask) << tt_pv_shift)
+         | ((std::uint64_t(record.generation) & tt_generation_mask) << tt_generation_shift);
 }
 
 [[nodiscard]] TTRecord unpack_payload(std::uint64_t payload) {
     const auto packed_score = std::uint16_t((payload >> tt_score_shift) & tt_score_mask);
+    const auto packed_static_eval =
+        std::uint16_t((payload >> tt_static_eval_shift) & tt_static_eval_mask);
 
     TTRecord record{};
-    record.move.bits  = MoveBits((payload >> tt_move_shift) & tt_move_mask);
-    record.score      = std::bit_cast<std::int16_t>(packed_score);
-    record.depth      = std::uint8_t((payload >> tt_depth_shift) & tt_depth_mask);
-    record.generation = std::uint8_t((payload >> tt_generation_shift) & tt_generation_mask);
-    record.bound      = TTBound((payload >> tt_bound_shift) & tt_bound_mask);
+    record.move.bits   = MoveBits((payload >> tt_move_shift) & tt_move_mask);
+    record.score       = std::bit_cast<std::int16_t>(packed_score);
+    record.static_eval = std::bit_cast<std::int16_t>(packed_static_eval);
+    record.depth       = std::uint8_t((payload >> tt_depth_shift) & tt_depth_mask);
+    record.bound       = TTBound((payload >> tt_bound_shift) & tt_bound_mask);
+    record.pv          = ((payload >> tt_pv_shift) & tt_pv_mask) != 0;
+    record.generation  = std::uint8_t((payload >> tt_generation_shift) & tt_generation_mask);
     return record;
 }
 
-[[nodiscard]] std::uint64_t make_signature(PositionKey zkey, std::uint64_t payload) {
-    return zkey ^ payload ^ tt_signature_salt;
+[[nodiscard]] std::uint32_t key_fragment(PositionKey zkey) {
+    return std::uint32_t(zkey);
+}
+
+// Multiplicative mix so a torn pairing of one payload with another's check word fails.
+[[nodiscard]] std::uint32_t mix_payload(std::uint64_t payload) {
+    return std::uint32_t((payload * tt_signature_salt) >> 32);
+}
+
+[[nodiscard]] std::uint32_t make_signature(PositionKey zkey, std::uint64_t payload) {
+    return key_fragment(zkey) ^ mix_payload(payload);
 }
 
-[[nodiscard]] PositionKey recover_key(std::uint64_t signature, std::uint64_t payload) {
-    return signature ^ payload ^ tt_signature_salt;
+[[nodiscard]] std::uint32_t recover_key_fragment(std::uint32_t signature, std::uint64_t payload) {
+    return signature ^ mix_payload(payload);
 }
 
-[[nodiscard]] std::optional<TTSnapshot> load_snapshot(const TTEntry& entry) {
-    const std::uint64_t signature_before = entry.signature.load(std::memory_order_acquire);
-    const std::uint64_t payload          = entry.payload.load(std::memory_order_relaxed);
-    const std::uint64_t signature_after  = entry.signature.load(std::memory_order_acquire);
+[[nodiscard]] std::optional<TTSnapshot> load_snapshot(const TTCluster& cluster, int slot) {
+    const std::uint32_t signature_before = cluster.signatures[slot].load(std::memory_order_acquire);
+    const std::uint64_t payload          = cluster.payloads[slot].load(std::memory_order_relaxed);
+    const std::uint32_t signature_after  = cluster.signatures[slot].load(std::memory_order_acquire);
     if (signature_before != signature_after)
         return std::nullopt;
 
@@ -73,19 +124,13 @@ struct TTSnapshot {
     if (!record.is_valid())
         return std::nullopt;
 
-    return TTSnapshot{.key = recover_key(signature_after, payload), .record = record};
-}
-
-void clear_entry(TTEntry& entry) {
-    entry.payload.store(0, std::memory_order_relaxed);
-    entry.signature.store(0, std::memory_order_relaxed);
+    return TTSnapshot{.key_fragment = recover_key_fragment(signature_after, payload),
+                      .record       = record};
 }
 } // namespace
 
-TranspositionTable tt{};
-
-TranspositionTable::TranspositionTable() {
-    resize(engine::default_hash_mb);
+TranspositionTable::TranspositionTable(size_t megabytes) {
+    resize(megabytes);
 }
 
 std::size_t TranspositionTable::capacity_mb() const noexcept {
@@ -94,24 +139,38 @@ std::size_t TranspositionTable::capacity_mb() const noexcept {
 }
 
 std::optional<TTRecord> TranspositionTable::probe(PositionKey zkey) const {
-    const TTCluster& cluster = clusters[cluster_index(zkey)];
+    const TTCluster&    cluster  = clusters[cluster_index(zkey)];
+    const std::uint32_t fragment = key_fragment(zkey);
 
-    for (const TTEntry& entry : cluster.entries) {
-        auto snapshot = load_snapshot(entry);
-        if (snapshot && snapshot->key == zkey)
+    for (int slot = 0; slot < TTCluster::size; ++slot) {
+        auto snapshot = load_snapshot(cluster, slot);
+        if (snapshot && snapshot->key_fragment == fragment)
             return snapshot->record;
     }
 
     return std::nullopt;
 }
 
-void TranspositionTable::store(
-    PositionKey zkey, Move move, EvalValue score, int depth, TTBound bound, int ply) {
+void TranspositionTable::store(PositionKey zkey,
+                               Move        move,
+                               EvalValue   score,
+                               int         depth,
+                               TTBound     bound,
+                               int         ply,
+                               EvalValue   static_eval,
+                               bool        pv) {
     assert(depth >= 0 && depth <= engine::max_search_ply);
     assert(score >= std::numeric_limits<std::int16_t>::min()
            && score <= std::numeric_limits<std::int16_t>::max());
+    assert(static_eval >= std::numeric_limits<std::int16_t>::min()
+           && static_eval <= std::numeric_limits<std::int16_t>::max());
 
-    TTCluster& cluster = clusters[cluster_index(zkey)];
+    // The packed bound field cannot represent anything else, and None would read as a miss.
+    if (!TTRecord{.bound = bound}.is_valid())
+        return;
+
+    TTCluster&          cluster  = clusters[cluster_index(zkey)];
+    const std::uint32_t fragment = key_fragment(zkey);
 
     // convert mate from root score into mate from current position
     if (score >= eval_value::tt_mate_bound)
@@ -122,18 +181,18 @@ void TranspositionTable::store(
            && score <= std::numeric_limits<std::int16_t>::max());
 
     // replacement policy: prefer same key, then lowest replacement score
-    TTEntry* target = &cluster.entries[0];
+    int      target = 0;
     TTRecord target_record{};
     int      target_replacement_score = std::numeric_limits<int>::max();
     bool     target_is_same_key       = false;
 
-    for (TTEntry& entry : cluster.entries) {
-        auto snapshot = load_snapshot(entry);
-        if (snapshot && snapshot->key == zkey) {
+    for (int slot = 0; slot < TTCluster::size; ++slot) {
+        auto snapshot = load_snapshot(cluster, slot);
+        if (snapshot && snapshot->key_fragment == fragment) {
             if (bound != TTBound::Exact && depth + 2 < int(snapshot->record.depth))
                 return;
 
-            target             = &entry;
+            target             = slot;
             target_record      = snapshot->record;
             target_is_same_key = true;
             break;
@@ -141,51 +200,208 @@ void TranspositionTable::store(
 
         const int replacement_score = snapshot ? snapshot->record.replacement_score(generation)
                                                : std::numeric_limits<int>::min();
-        if (!target_is_same_key && replacement_score < target_replacement_score) {
-            target                   = &entry;
+        if (replacement_score < target_replacement_score) {
+            target                   = slot;
             target_replacement_score = replacement_score;
         }
     }
 
     if (target_is_same_key && move.is_null())
         move = target_record.move;
+    if (target_is_same_key && static_eval == eval_value::none)
+        static_eval = target_record.static_eval;
 
     const TTRecord record{
-        .move       = move,
-        .score      = std::int16_t(score),
-        .depth      = std::uint8_t(depth),
-        .generation = generation,
-        .bound      = bound,
+        .move        = move,
+        .score       = std::int16_t(score),
+        .static_eval = std::int16_t(static_eval),
+        .depth       = std::uint8_t(depth),
+        .generation  = generation,
+        .bound       = bound,
+        .pv          = pv,
     };
 
     const std::uint64_t payload   = pack_payload(record);
-    const std::uint64_t signature = make_signature(zkey, payload);
+    const std::uint32_t signature = make_signature(zkey, payload);
+
+    cluster.payloads[target].store(payload, std::memory_order_relaxed);
+    cluster.signatures[target].store(signature, std::memory_order_release);
+}
+
+void TranspositionTable::clear(size_t thread_count) {
+    const size_t max_threads = std::max<size_t>(1, cluster_count / tt_min_clear_slice);
+    const size_t threads     = std::clamp<size_t>(thread_count, 1, max_threads);
+    const size_t slice       = (cluster_count + threads - 1) / threads;
+
+    {
+        std::vector<std::jthread> helpers;
+        helpers.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            const size_t begin = std::min(cluster_count, i * slice);
+            const size_t end   = std::min(cluster_count, begin + slice);
+            helpers.emplace_back([this, begin, end] { clear_clusters(begin, end); });
+        }
+
+        clear_clusters(0, std::min(cluster_count, slice));
+    }
+
+    // Other processes keep stamping entries with the shared generation.
+    if (!memory.shared_header())
+        generation = 0;
+}
+
+// Re-create empty clusters in place; this also begins their lifetime in fresh mappings.
+void TranspositionTable::clear_clusters(size_t begin, size_t end) {
+    if (!memory.shared_header()) {
+        std::uninitialized_default_construct_n(clusters + begin, end - begin);
+        return;
+    }
+
+    // Other processes may be probing and storing, so empty each live word atomically; a zero
+    // payload has no bound and reads as a miss.
+    for (size_t index = begin; index < end; ++index) {
+        for (int slot = 0; slot < TTCluster::size; ++slot) {
+            clusters[index].payloads[slot].store(0, std::memory_order_relaxed);
+            clusters[index].signatures[slot].store(0, std::memory_order_release);
+        }
+    }
+}
+
+void TranspositionTable::save(const std::string& path) const {
+    TTFileHeader header{};
+    header.magic         = tt_file_magic;
+    header.version       = tt_file_version;
+    header.cluster_bytes = sizeof(TTCluster);
+    header.cluster_count = cluster_count;
+    header.evaluator     = evaluator_identity;
+    header.generation    = generation;
+
+    // Write beside the target and rename, so a table mapped from path stays intact.
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("cannot create hash file: " + path);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(clusters),
+                   std::streamsize(cluster_count * sizeof(TTCluster)));
+        if (!file.flush())
+            throw std::runtime_error("cannot write hash file: " + path);
+    }
 
-    target->payload.store(payload, std::memory_order_relaxed);
-    target->signature.store(signature, std::memory_order_release);
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error)
+        throw std::runtime_error("cannot write hash file: " + path);
 }
 
-void TranspositionTable::clear() {
-    for (std::size_t i = 0; i < cluster_count; ++i) {
-        for (auto& entry : clusters[i].entries)
-            clear_entry(entry);
+void TranspositionTable::load(const std::string& path) {
+    TTFileHeader header{};
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("cannot open hash file: " + path);
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || header.magic != tt_file_magic)
+            throw std::runtime_error("not a hash file: " + path);
     }
-    generation = 0;
+
+    if (header.version != tt_file_version || header.cluster_bytes != sizeof(TTCluster))
+        throw std::runtime_error("unsupported hash file version: " + path);
+    if (header.evaluator != evaluator_identity)
+        throw std::runtime_error("hash file was saved with a different evaluator: " + path);
+
+    constexpr std::uint64_t min_clusters = (std::uint64_t{1} << 20) / sizeof(TTCluster);
+    constexpr std::uint64_t max_clusters =
+        (std::uint64_t(engine::max_hash_mb) << 20) / sizeof(TTCluster);
+    const std::uint64_t count = header.cluster_count;
+
+    std::error_code     error;
+    const std::uint64_t file_bytes = std::filesystem::file_size(path, error);
+    if (error || count < min_clusters || count > max_clusters || !std::has_single_bit(count)
+        || file_bytes != sizeof(header) + count * sizeof(TTCluster))
+        throw std::runtime_error("corrupt hash file: " + path);
+
+    auto new_memory = TTMemory::map_file(path, sizeof(header), count * sizeof(TTCluster));
+
+    // Clusters hold only lock-free atomic words, so the mapped bytes are used as saved.
+    memory        = std::move(new_memory);
+    clusters      = static_cast<TTCluster*>(memory.data());
+    cluster_count = count;
+    shift         = 64 - std::countr_zero(count);
+    generation    = std::uint8_t(header.generation % tt_generation_cycle);
 }
 
-void TranspositionTable::resize(size_t mb) {
+void TranspositionTable::attach_shared(const std::string& name, size_t mb, size_t thread_count) {
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free
+                      && std::atomic<std::uint32_t>::is_always_lock_free,
+                  "shared clusters need address-free atomics");
+
+    if (mb == 0)
+        mb = 1;
+
+    const std::uint64_t bytes             = mb << 20;
+    const size_t        new_cluster_count = std::bit_floor(bytes / sizeof(TTCluster));
+
+    // Reopening the mapped segment at another size would fail its size check, so a process
+    // that is its only user resizes it in place; clusters are indexed by the count, so the
+    // resized table starts empty.
+    if (memory.maps_shared(name)) {
+        if (new_cluster_count == cluster_count)
+            return;
+
+        memory.resize_shared(new_cluster_count * sizeof(TTCluster));
+        clusters      = static_cast<TTCluster*>(memory.data());
+        cluster_count = new_cluster_count;
+        shift         = 64 - std::countr_zero(new_cluster_count);
+        clear(thread_count);
+        return;
+    }
+
+    auto new_memory = TTMemory::open_shared(name, new_cluster_count * sizeof(TTCluster));
+
+    std::uint64_t recorded = 0;
+    if (!new_memory.shared_header()->evaluator.compare_exchange_strong(recorded,
+                                                                       evaluator_identity)
+        && recorded != evaluator_identity)
+        throw std::runtime_error("shared hash is used with a different evaluator: " + name);
+
+    memory        = std::move(new_memory);
+    clusters      = static_cast<TTCluster*>(memory.data());
+    cluster_count = new_cluster_count;
+    shift         = 64 - std::countr_zero(new_cluster_count);
+    generation    = std::uint8_t(memory.shared_header()->generation.load(std::memory_order_relaxed)
+                              % tt_generation_cycle);
+}
+
+void TranspositionTable::set_evaluator(std::uint64_t identity, size_t thread_count) {
+    if (identity == evaluator_identity)
+        return;
+    if (memory.shared_header())
+        throw std::runtime_error("cannot change the evaluator of a shared hash");
+
+    clear(thread_count);
+    evaluator_identity = identity;
+}
+
+void TranspositionTable::resize(size_t mb, size_t thread_count) {
     if (mb == 0)
         mb = 1;
 
     const std::uint64_t bytes             = mb << 20;
     const size_t        new_cluster_count = std::bit_floor(bytes / sizeof(TTCluster));
     const int           new_shift         = 64 - std::countr_zero(new_cluster_count);
-    auto                new_clusters      = std::make_unique<TTCluster[]>(new_cluster_count);
 
-    clusters      = std::move(new_clusters);
+    // Map the new table before releasing the old one so allocation failure keeps it intact.
+    auto new_memory = TTMemory::allocate(new_cluster_count * sizeof(TTCluster));
+
+    memory        = std::move(new_memory);
+    clusters      = static_cast<TTCluster*>(memory.data());
     cluster_count = new_cluster_count;
     shift         = new_shift;
-    generation    = 0;
+
+    clear(thread_count);
 }
 
 } // namespace search
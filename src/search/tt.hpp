@@ -4,17 +4,15 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <memory>
 #include <optional>
+#include <string>
 
 #include "core/constants.hpp"
 #include "core/move.hpp"
+#include "search/tt_memory.hpp"
 
 namespace search {
 
-class TranspositionTable;
-extern TranspositionTable tt;
-
 enum class TTBound : std::uint8_t {
     None,
     Exact,
@@ -31,18 +29,22 @@ tt_bound_for_window(EvalValue value, EvalValue alpha, EvalValue beta) noexcept {
     return TTBound::Exact;
 }
 
-struct TTEntry {
-    std::atomic<std::uint64_t> payload   = 0;
-    std::atomic<std::uint64_t> signature = 0;
-};
+// Generations wrap within the packed payload's generation field.
+inline constexpr int tt_generation_cycle = 32;
+
+// Evaluator identity of the handcrafted evaluator; networks use their parameter fingerprint.
+// Zero is reserved for a shared segment that has no evaluator recorded yet.
+inline constexpr std::uint64_t tt_handcrafted_evaluator = 1;
 
 // Decoded compact TT payload record; search/eval arithmetic stays wider at API boundaries.
 struct TTRecord {
-    Move         move       = NULL_MOVE;
-    std::int16_t score      = 0;
-    std::uint8_t depth      = 0;
-    std::uint8_t generation = 0;
-    TTBound      bound      = TTBound::None;
+    Move         move        = NULL_MOVE;
+    std::int16_t score       = 0;
+    std::int16_t static_eval = eval_value::none;
+    std::uint8_t depth       = 0;
+    std::uint8_t generation  = 0;
+    TTBound      bound       = TTBound::None;
+    bool         pv          = false;
 
     [[nodiscard]] bool is_valid() const {
         switch (bound) {
@@ -53,6 +55,9 @@ struct TTRecord {
         }
         return false;
     }
+    [[nodiscard]] bool has_static_eval() const noexcept {
+        return static_eval != eval_value::none;
+    }
     int                replacement_score(int current_generation) const noexcept;
     EvalValue          score_at_ply(int ply) const noexcept;
     [[nodiscard]] bool can_cutoff(EvalValue adjusted_score,
@@ -60,46 +65,107 @@ struct TTRecord {
                                   EvalValue alpha,
                                   EvalValue beta) const noexcept;
 };
-static_assert(sizeof(TTRecord) == 8);
+static_assert(sizeof(TTRecord) == 10);
 
+// One cache line holds five 12-byte entries: a packed 64-bit payload plus a 32-bit check
+// word binding it to the position key. Parallel arrays keep every word naturally aligned.
 struct alignas(64) TTCluster {
-    static constexpr int size = 4;
+    static constexpr int size = 5;
 
-    TTEntry entries[size] = {};
+    std::atomic<std::uint64_t> payloads[size]   = {};
+    std::atomic<std::uint32_t> signatures[size] = {};
 };
+static_assert(sizeof(TTCluster) == 64);
 
 class TranspositionTable {
 public:
-    explicit TranspositionTable();
+    explicit TranspositionTable(size_t megabytes = engine::default_hash_mb);
 
-    // Shared probes return detached, validated snapshots. Stores publish the payload before its
-    // full-key XOR signature, so races produce a miss or a complete old or new record.
+    // Shared probes return detached, validated snapshots. Stores publish the payload before a
+    // check word mixing it with 32 key bits, so races produce a miss or a complete old or new
+    // record; the cluster index and check word together verify the key.
     [[nodiscard]] std::optional<TTRecord> probe(PositionKey zkey) const;
-    void store(PositionKey zkey, Move move, EvalValue score, int depth, TTBound bound, int ply);
-    void resize(size_t megabytes);
-    void clear();
-    [[nodiscard]] std::size_t capacity_mb() const noexcept;
-    // Advance the shared TT generation once per root-search lifecycle event.
-    void                       advance_generation() { ++generation; }
+    // static_eval may be eval_value::none; a same-key store then keeps the cached evaluation.
+    void store(PositionKey zkey,
+               Move        move,
+               EvalValue   score,
+               int         depth,
+               TTBound     bound,
+               int         ply,
+               EvalValue   static_eval = eval_value::none,
+               bool        pv          = false);
+    // Hint the cluster for zkey into cache ahead of a probe; never faults or blocks.
+    void prefetch(PositionKey zkey) const noexcept;
+    // Lifecycle calls require exclusive access. Both zero the table in parallel slices so
+    // multi-gigabyte tables are faulted in and cleared in a fraction of the serial time.
+    // Clearing a shared table empties it for every attached process, through atomic stores
+    // that their concurrent probes see as misses, and keeps the shared generation.
+    void resize(size_t megabytes, size_t thread_count = 1);
+    void clear(size_t thread_count = 1);
+    // Persist the table behind a versioned header. load() maps the file privately so a
+    // restart resumes with a warm table, paying only page faults as clusters are touched.
+    // Both require exclusive access and throw std::runtime_error on I/O or format errors;
+    // load() also rejects a file saved under a different evaluator.
+    void save(const std::string& path) const;
+    void load(const std::string& path);
+    // Back the table with a named shared-memory segment so several engine processes share
+    // entries. An existing segment of the same size keeps its contents; a new one starts
+    // empty. Cross-process races are covered by the same check-word validation as threads.
+    // The generation lives in the segment, so every process ages entries on one clock. The
+    // first process records its evaluator there; attaching under another one throws. Naming
+    // the segment already attached changes its size: allowed, emptying it, only while no
+    // other process uses it, and otherwise a std::runtime_error that keeps the table.
+    void attach_shared(const std::string& name, size_t megabytes, size_t thread_count = 1);
+    // Entries carry static evaluations that search reuses for pruning, so they are valid only
+    // for the evaluator that produced them. Changing it clears a private table and throws
+    // std::runtime_error for a shared one, which other processes keep using.
+    void                        set_evaluator(std::uint64_t identity, size_t thread_count = 1);
+    [[nodiscard]] std::uint64_t evaluator() const noexcept { return evaluator_identity; }
+    [[nodiscard]] std::size_t        capacity_mb() const noexcept;
+    [[nodiscard]] TTMemory::PageKind page_kind() const noexcept { return memory.page_kind(); }
+    // Advance the TT generation once per root-search lifecycle event. On a shared table this
+    // also advances it for the other processes, which pick it up at their next advance.
+    void                       advance_generation() noexcept;
     [[nodiscard]] std::uint8_t current_generation() const { return generation; }
 
 private:
     std::uint64_t cluster_index(PositionKey zkey) const;
 
-    std::unique_ptr<TTCluster[]> clusters = nullptr;
+    void clear_clusters(size_t begin, size_t end);
+
+    TTMemory   memory;
+    TTCluster* clusters = nullptr;
 
-    size_t       cluster_count = 0;
-    int          shift         = 0;
-    std::uint8_t generation    = 0;
+    size_t        cluster_count      = 0;
+    int           shift              = 0;
+    std::uint8_t  generation         = 0;
+    std::uint64_t evaluator_identity = tt_handcrafted_evaluator;
 };
 
 inline std::uint64_t TranspositionTable::cluster_index(PositionKey zkey) const {
     return (zkey * 0x9e3779b97f4a7c15ull) >> shift;
 }
 
+inline void TranspositionTable::advance_generation() noexcept {
+    if (auto* shared = memory.shared_header()) {
+        const std::uint32_t next = shared->generation.fetch_add(1, std::memory_order_relaxed) + 1;
+        generation               = std::uint8_t(next % tt_generation_cycle);
+    } else {
+        generation = std::uint8_t((generation + 1) % tt_generation_cycle);
+    }
+}
+
+inline void TranspositionTable::prefetch(PositionKey zkey) const noexcept {
+#if defined(__GNUC__)
+    __builtin_prefetch(&clusters[cluster_index(zkey)]);
+#else
+    (void)zkey;
+#endif
+}
+
 // lower score = better replacement candidate: prefer shallow entries, then older entries
 inline int TTRecord::replacement_score(int current_generation) const noexcept {
-    const int age_distance = std::uint8_t(std::uint8_t(current_generation) - generation);
+    const int age_distance = (current_generation - generation) & (tt_generation_cycle - 1);
     return int(depth) - 4 * age_distance;
 }
 
@@ -0,0 +1,329 @@
+#include "search/tt_memory.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LATRUNCULI_TT_MMAP 1
+#else
+#define LATRUNCULI_TT_MMAP 0
+#endif
+
+namespace search {
+
+namespace {
+
+constexpr std::size_t huge_page_bytes  = std::size_t{2} << 20;
+constexpr std::size_t cache_line_bytes = 64;
+
+static_assert(huge_page_bytes % cache_line_bytes == 0);
+static_assert(sizeof(TTMemory::SharedHeader) == cache_line_bytes);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free
+              && std::atomic<std::uint64_t>::is_always_lock_free);
+
+[[nodiscard]] constexpr std::size_t round_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// POSIX requires portable shared-memory names to start with a single slash.
+[[nodiscard]] std::string shared_memory_name(const std::string& name) {
+    return name.starts_with('/') ? name : "/" + name;
+}
+
+} // namespace
+
+TTMemory::~TTMemory() {
+    release();
+}
+
+TTMemory::TTMemory(TTMemory&& other) noexcept
+    : mapping(std::exchange(other.mapping, nullptr)),
+      mapping_length(std::exchange(other.mapping_length, 0)),
+      bytes_begin(std::exchange(other.bytes_begin, nullptr)),
+      byte_count(std::exchange(other.byte_count, 0)),
+      kind(std::exchange(other.kind, PageKind::None)),
+      shared_name(std::exchange(other.shared_name, {})),
+      shared_fd(std::exchange(other.shared_fd, -1)),
+      header(std::exchange(other.header, nullptr)) {}
+
+TTMemory& TTMemory::operator=(TTMemory&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapping        = std::exchange(other.mapping, nullptr);
+        mapping_length = std::exchange(other.mapping_length, 0);
+        bytes_begin    = std::exchange(other.bytes_begin, nullptr);
+        byte_count     = std::exchange(other.byte_count, 0);
+        kind           = std::exchange(other.kind, PageKind::None);
+        shared_name    = std::exchange(other.shared_name, {});
+        shared_fd      = std::exchange(other.shared_fd, -1);
+        header         = std::exchange(other.header, nullptr);
+    }
+    return *this;
+}
+
+TTMemory TTMemory::allocate(std::size_t bytes) {
+    TTMemory memory;
+    if (bytes == 0)
+        return memory;
+
+#if LATRUNCULI_TT_MMAP
+    constexpr int protection = PROT_READ | PROT_WRITE;
+    constexpr int flags      = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(MAP_HUGETLB)
+    // Explicit huge pages need a reserved pool; fall back silently when none is configured.
+    if (bytes >= huge_page_bytes) {
+        const std::size_t length = round_up(bytes, huge_page_bytes);
+        void*             region = mmap(nullptr, length, protection, flags | MAP_HUGETLB, -1, 0);
+        if (region != MAP_FAILED) {
+            memory.mapping        = region;
+            memory.mapping_length = length;
+            memory.bytes_begin    = region;
+            memory.byte_count     = bytes;
+            memory.kind           = PageKind::Explicit;
+            return memory;
+        }
+    }
+#endif
+
+    // Over-map by one huge page so the table can start on a huge-page boundary, which lets
+    // the kernel back it with transparent huge pages from the first cluster.
+    const bool        align_huge = bytes >= huge_page_bytes;
+    const std::size_t length     = align_huge ? bytes + huge_page_bytes : bytes;
+    void*             region     = mmap(nullptr, length, protection, flags, -1, 0);
+    if (region == MAP_FAILED)
+        throw std::bad_alloc();
+
+    auto address = reinterpret_cast<std::uintptr_t>(region);
+    if (align_huge)
+        address = round_up(address, huge_page_bytes);
+
+    memory.mapping        = region;
+    memory.mapping_length = length;
+    memory.bytes_begin    = reinterpret_cast<void*>(address);
+    memory.byte_count     = bytes;
+    memory.kind           = PageKind::Regular;
+
+#if defined(MADV_HUGEPAGE)
+    if (align_huge && madvise(memory.bytes_begin, bytes, MADV_HUGEPAGE) == 0)
+        memory.kind = PageKind::Transparent;
+#endif
+
+    return memory;
+#else
+    void* region = ::operator new(bytes, std::align_val_t{cache_line_bytes});
+    std::memset(region, 0, bytes);
+
+    memory.mapping        = region;
+    memory.mapping_length = bytes;
+    memory.bytes_begin    = region;
+    memory.byte_count     = bytes;
+    memory.kind           = PageKind::Regular;
+    return memory;
+#endif
+}
+
+TTMemory TTMemory::map_file(const std::string& path, std::size_t offset, std::size_t bytes) {
+    TTMemory memory;
+    if (bytes == 0)
+        return memory;
+
+#if LATRUNCULI_TT_MMAP
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("cannot open hash file: " + path);
+
+    // A private writable mapping lets search update entries without touching the file.
+    const std::size_t length = offset + bytes;
+    void*             region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED)
+        throw std::runtime_error("cannot map hash file: " + path);
+
+    memory.mapping        = region;
+    memory.mapping_length = length;
+    memory.bytes_begin    = static_cast<unsigned char*>(region) + offset;
+    memory.byte_count     = bytes;
+    memory.kind           = PageKind::File;
+    return memory;
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw std::runtime_error("cannot open hash file: " + path);
+
+    memory = allocate(bytes);
+    file.seekg(std::streamoff(offset));
+    file.read(static_cast<char*>(memory.bytes_begin), std::streamsize(bytes));
+    if (!file)
+        throw std::runtime_error("cannot read hash file: " + path);
+
+    memory.kind = PageKind::File;
+    return memory;
+#endif
+}
+
+TTMemory TTMemory::open_shared(const std::string& name, std::size_t bytes) {
+    TTMemory memory;
+    if (bytes == 0)
+        return memory;
+
+#if LATRUNCULI_TT_MMAP
+    const std::string segment = shared_memory_name(name);
+    const std::size_t length  = sizeof(SharedHeader) + bytes;
+
+    // Attach and detach hold an exclusive lock, so the user count, sizing, and the last
+    // user's unlink never interleave across processes.
+    int fd = -1;
+    for (;;) {
+        fd = shm_open(segment.c_str(), O_RDWR | O_CREAT, 0600);
+        if (fd < 0)
+            throw std::runtime_error("cannot open shared hash: " + name);
+
+        struct stat status {};
+        if (flock(fd, LOCK_EX) != 0 || fstat(fd, &status) != 0) {
+            close(fd);
+            throw std::runtime_error("cannot open shared hash: " + name);
+        }
+
+        // The last user unlinked this segment after we opened it; open the current one.
+        if (status.st_nlink == 0) {
+            close(fd);
+            continue;
+        }
+
+        // A zero size is a segment its creator has not sized yet; ftruncate is idempotent
+        // and zero-fills, which reads as an empty table.
+        if (status.st_size == 0 && ftruncate(fd, off_t(length)) != 0) {
+            close(fd);
+            throw std::runtime_error("cannot size shared hash: " + name);
+        }
+        if (status.st_size != 0 && std::size_t(status.st_size) != length) {
+            close(fd);
+            throw std::runtime_error("shared hash has a different size: " + name);
+        }
+        break;
+    }
+
+    void* region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (region == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("cannot map shared hash: " + name);
+    }
+
+    auto* shared = static_cast<SharedHeader*>(region);
+    shared->users.fetch_add(1, std::memory_order_relaxed);
+    flock(fd, LOCK_UN);
+
+    memory.mapping        = region;
+    memory.mapping_length = length;
+    memory.bytes_begin    = static_cast<unsigned char*>(region) + sizeof(SharedHeader);
+    memory.byte_count     = bytes;
+    memory.kind           = PageKind::Shared;
+    memory.shared_name    = segment;
+    memory.shared_fd      = fd;
+    memory.header         = shared;
+    return memory;
+#else
+    throw std::runtime_error("shared hash is not supported on this platform: " + name);
+#endif
+}
+
+void TTMemory::resize_shared(std::size_t bytes) {
+    assert(kind == PageKind::Shared);
+
+#if LATRUNCULI_TT_MMAP
+    const std::string name   = shared_name.substr(1);
+    const std::size_t length = sizeof(SharedHeader) + bytes;
+
+    // Holding the lock keeps other processes from attaching while the segment changes size.
+    if (flock(shared_fd, LOCK_EX) != 0)
+        throw std::runtime_error("cannot resize shared hash: " + name);
+    if (header->users.load(std::memory_order_relaxed) != 1) {
+        flock(shared_fd, LOCK_UN);
+        throw std::runtime_error("cannot resize a shared hash other processes use: " + name);
+    }
+
+    // Map the new length before truncating, so a failure leaves the current mapping usable.
+    void* region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, shared_fd, 0);
+    if (region == MAP_FAILED) {
+        flock(shared_fd, LOCK_UN);
+        throw std::runtime_error("cannot map shared hash: " + name);
+    }
+    if (ftruncate(shared_fd, off_t(length)) != 0) {
+        munmap(region, length);
+        flock(shared_fd, LOCK_UN);
+        throw std::runtime_error("cannot size shared hash: " + name);
+    }
+    flock(shared_fd, LOCK_UN);
+
+    munmap(mapping, mapping_length);
+    mapping        = region;
+    mapping_length = length;
+    bytes_begin    = static_cast<unsigned char*>(region) + sizeof(SharedHeader);
+    byte_count     = bytes;
+    header         = static_cast<SharedHeader*>(region);
+#else
+    (void)bytes;
+    throw std::runtime_error("shared hash is not supported on this platform");
+#endif
+}
+
+bool TTMemory::maps_shared(const std::string& name) const {
+    return kind == PageKind::Shared && shared_name == shared_memory_name(name);
+}
+
+void TTMemory::remove_shared(const std::string& name) noexcept {
+#if LATRUNCULI_TT_MMAP
+    shm_unlink(shared_memory_name(name).c_str());
+#else
+    (void)name;
+#endif
+}
+
+void TTMemory::release() noexcept {
+    if (!mapping)
+        return;
+
+#if LATRUNCULI_TT_MMAP
+    if (kind == PageKind::Shared)
+        detach_shared();
+    munmap(mapping, mapping_length);
+#else
+    ::operator delete(mapping, std::align_val_t{cache_line_bytes});
+#endif
+
+    mapping        = nullptr;
+    mapping_length = 0;
+    bytes_begin    = nullptr;
+    byte_count     = 0;
+    kind           = PageKind::None;
+}
+
+void TTMemory::detach_shared() noexcept {
+#if LATRUNCULI_TT_MMAP
+    // A segment already unlinked by remove_shared() has no name left to remove.
+    struct stat status {};
+    if (flock(shared_fd, LOCK_EX) == 0) {
+        const bool last = header->users.fetch_sub(1, std::memory_order_relaxed) == 1;
+        if (last && fstat(shared_fd, &status) == 0 && status.st_nlink != 0)
+            shm_unlink(shared_name.c_str());
+    }
+    close(shared_fd);
+
+    shared_name.clear();
+    shared_fd = -1;
+    header    = nullptr;
+#endif
+}
+
+} // namespace search
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace search {
+
+// Owned page mapping backing the transposition-table cluster array. Large tables prefer
+// explicit huge pages, then transparent huge pages, so TT probes touch fewer TLB entries.
+class TTMemory {
+public:
+    enum class PageKind { None, Regular, Transparent, Explicit, File, Shared };
+
+    // Leads every shared segment, padded to a cache line so the clusters after it stay
+    // aligned. Zero-filled on creation: no users, generation zero, and no evaluator recorded.
+    struct SharedHeader {
+        std::atomic<std::uint32_t> users;
+        std::atomic<std::uint32_t> generation;
+        std::atomic<std::uint64_t> evaluator;
+        std::uint8_t               reserved[48];
+    };
+
+    TTMemory() = default;
+    ~TTMemory();
+    TTMemory(const TTMemory&)            = delete;
+    TTMemory& operator=(const TTMemory&) = delete;
+    TTMemory(TTMemory&& other) noexcept;
+    TTMemory& operator=(TTMemory&& other) noexcept;
+
+    // Maps at least bytes of zero-filled memory; throws std::bad_alloc on failure.
+    [[nodiscard]] static TTMemory allocate(std::size_t bytes);
+    // Privately maps bytes of path starting at offset; pages fault in lazily on first touch
+    // and writes never reach the file. Throws std::runtime_error if the file cannot be mapped.
+    [[nodiscard]] static TTMemory map_file(const std::string& path,
+                                           std::size_t        offset,
+                                           std::size_t        bytes);
+    // Maps the named POSIX shared-memory segment, creating it zero-filled when absent, so
+    // cooperating processes see one table. Throws std::runtime_error if the segment exists
+    // with a different size or cannot be mapped. The last mapping to be released unlinks the
+    // segment; one left behind by a crashed process stays until remove_shared() or reboot.
+    [[nodiscard]] static TTMemory open_shared(const std::string& name, std::size_t bytes);
+    // Unlinks the named segment; current mappings stay valid but new opens start empty.
+    static void remove_shared(const std::string& name) noexcept;
+    // Resizes this shared mapping's segment in place to bytes after the header, which is kept.
+    // Bytes within both sizes keep their contents and added ones read as zero. Throws
+    // std::runtime_error, keeping the current mapping, if other processes have the segment
+    // mapped or it cannot be resized.
+    void resize_shared(std::size_t bytes);
+    // Whether this is a mapping of the named shared-memory segment.
+    [[nodiscard]] bool maps_shared(const std::string& name) const;
+
+    [[nodiscard]] void*       data() const noexcept { return bytes_begin; }
+    [[nodiscard]] std::size_t size() const noexcept { return byte_count; }
+    [[nodiscard]] PageKind    page_kind() const noexcept { return kind; }
+    // Header of a shared segment, or null for private memory.
+    [[nodiscard]] SharedHeader* shared_header() const noexcept { return header; }
+
+private:
+    void release() noexcept;
+    void detach_shared() noexcept;
+
+    // Mapping returned by the OS; bytes_begin may be aligned inside it.
+    void*       mapping        = nullptr;
+    std::size_t mapping_length = 0;
+
+    void*       bytes_begin = nullptr;
+    std::size_t byte_count  = 0;
+    PageKind    kind        = PageKind::None;
+
+    // Shared segments keep their descriptor open so detaching can lock and unlink them.
+    std::string   shared_name;
+    int           shared_fd = -1;
+    SharedHeader* header    = nullptr;
+};
+
+} // namespace search
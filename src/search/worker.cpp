@@ -12,14 +12,22 @@
 
 namespace search {
 
-Worker::Worker(int id, Reporter& reporter, ThreadPool& pool)
+Worker::Worker(int id, Reporter& reporter, TranspositionTable& tt, ThreadPool& pool)
     : reporter(reporter),
+      tt(tt),
       thread_pool(pool),
       worker_id(id) {}
 
 // Configuration.
+void Worker::set_network(const eval::nnue::Network* new_network) {
+    // Cached values and accumulators belong to the previous evaluator.
+    network = new_network;
+    eval_cache.clear();
+    accumulators.clear();
+}
+
 void Worker::configure_search(const Board& root_board, Limits limits, TimePoint search_start_time) {
-    board      = root_board;
+    board.assign_search_root(root_board);
     search_ply = 0;
 
     this->limits   = limits;
@@ -81,7 +89,7 @@ EvalValue Worker::search() {
 void Worker::reset_search_state() {
     reset_nodes();
     search_ply  = 0;
-    root_result = RootLine{NULL_MOVE, eval::evaluate(board), 0, false};
+    root_result = RootLine{NULL_MOVE, evaluate_board(), 0, false};
     root_lines.clear();
     last_reported_root_line.reset();
     pending_best_move.reset();
@@ -104,7 +112,7 @@ void Worker::build_root_lines() {
     auto       picker  = ordering::Picker::for_main_search(board, ordering_state, context, 0);
 
     for (Move move = picker.next(); !move.is_null(); move = picker.next()) {
-        if (board.is_legal_pseudo_move(move) && limits.allows_root_move(move))
+        if (limits.allows_root_move(move))
             root_lines.push_back(RootLine{.root_move = move, .value = -eval_value::inf});
     }
 }
@@ -7,6 +7,12 @@
 
 #include "board/board.hpp"
 #include "core/types.hpp"
+#include "eval/eval_cache.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/material_table.hpp"
+#include "eval/nnue/accumulator.hpp"
+#include "eval/nnue/network.hpp"
+#include "eval/pawn_table.hpp"
 #include "search/instrumentation.hpp"
 #include "search/limits.hpp"
 #include "search/ordering/state.hpp"
@@ -19,6 +25,7 @@ namespace search {
 
 class ThreadPool;
 class Thread;
+class TranspositionTable;
 
 enum class NodeType { Pv, NonPv };
 
@@ -26,7 +33,7 @@ enum class NodeType { Pv, NonPv };
 class Worker {
 public:
     Worker() = delete;
-    Worker(int id, Reporter& reporter, ThreadPool& pool);
+    Worker(int id, Reporter& reporter, TranspositionTable& tt, ThreadPool& pool);
     Worker(const Worker&)            = delete;
     Worker& operator=(const Worker&) = delete;
     Worker(Worker&&)                 = delete;
@@ -41,6 +48,9 @@ public:
     NodeCount node_count() const noexcept;
     RootLine  root_snapshot() const;
 
+    // ThreadPool-facing configuration; null selects the handcrafted evaluator.
+    void set_network(const eval::nnue::Network* network);
+
 private:
     // Board and search state.
     Board                 board;
@@ -48,6 +58,11 @@ private:
     RootLine              root_result;
     std::vector<RootLine> root_lines;
     ordering::State       ordering_state;
+    eval::EvalCache       eval_cache;
+    eval::PawnTable       pawn_table;
+    eval::MaterialTable   material_table;
+    // Network accumulators along the board's history; unused without a network.
+    eval::nnue::AccumulatorStack accumulators;
 
     // Current search request.
     Limits                      limits;
@@ -58,10 +73,12 @@ private:
     std::atomic<NodeCount> nodes{0};
     Instrumentation<>      stats;
 
-    // Non-owning shared services. Both must outlive this worker.
-    Reporter&   reporter;
-    ThreadPool& thread_pool;
-    const int   worker_id;
+    // Non-owning shared services. All must outlive this worker.
+    Reporter&                  reporter;
+    TranspositionTable&        tt;
+    ThreadPool&                thread_pool;
+    const int                  worker_id;
+    const eval::nnue::Network* network = nullptr;
 
     // Stop state.
     std::atomic<bool> stop_requested_flag{false};
@@ -101,6 +118,8 @@ private:
                         bool                can_null = true);
     template <NodeType Node = NodeType::NonPv>
     EvalValue quiescence(EvalValue alpha, EvalValue beta, PrincipalVariation* pv = nullptr);
+    EvalValue              evaluate_board();
+    eval::CachedEvaluation lazy_evaluate_board(EvalValue alpha, EvalValue beta);
 
     // Accounting and limits.
     Milliseconds runtime() const;
@@ -132,6 +151,34 @@ inline void Worker::increment_nodes() noexcept {
     nodes.fetch_add(1, std::memory_order_relaxed);
 }
 
+// Static evaluation through this worker's eval cache: the network when one is loaded, else the
+// handcrafted evaluator with its pawn and material tables.
+inline EvalValue Worker::evaluate_board() {
+    const eval::CachedEvaluation result =
+        network ? eval::nnue::evaluate_cached(board, eval_cache, accumulators, *network)
+                : eval::evaluate_cached(board, eval_cache, pawn_table, material_table);
+    if (result.hit)
+        stats.eval_cache_hit(search_ply);
+    else
+        stats.eval_cache_miss(search_ply);
+    return result.value;
+}
+
+// Stand-pat evaluation: far outside [alpha, beta] the material and PSQT estimate decides. The
+// lazy margin is measured for the handcrafted evaluator, so networks always evaluate fully.
+inline eval::CachedEvaluation Worker::lazy_evaluate_board(EvalValue alpha, EvalValue beta) {
+    const eval::CachedEvaluation result =
+        network ? eval::nnue::evaluate_cached(board, eval_cache, accumulators, *network)
+                : eval::evaluate_lazy(board, alpha, beta, eval_cache, pawn_table, material_table);
+    if (result.hit)
+        stats.eval_cache_hit(search_ply);
+    else
+        stats.eval_cache_miss(search_ply);
+    if (!result.exact)
+        stats.lazy_eval_exit(search_ply);
+    return result;
+}
+
 inline bool Worker::stop_requested() const noexcept {
     return stop_requested_flag.load(std::memory_order_relaxed);
 }
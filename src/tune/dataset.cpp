@@ -0,0 +1,145 @@
+#include "tune/dataset.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include "board/board.hpp"
+
+namespace tune {
+
+namespace {
+
+std::vector<std::string_view> split_fields(std::string_view line) {
+    std::vector<std::string_view> fields;
+    std::size_t                   begin = line.find_first_not_of(" \t\r");
+    while (begin != std::string_view::npos) {
+        const std::size_t end = line.find_first_of(" \t\r", begin);
+        fields.push_back(line.substr(begin, end - begin));
+        begin = line.find_first_not_of(" \t\r", end);
+    }
+    return fields;
+}
+
+bool is_number(std::string_view field) {
+    int value = 0;
+    return std::from_chars(field.data(), field.data() + field.size(), value).ptr
+        == field.data() + field.size();
+}
+
+double parse_result(std::string_view field) {
+    while (!field.empty() && std::string_view("\"[;").contains(field.front()))
+        field.remove_prefix(1);
+    while (!field.empty() && std::string_view("\"];").contains(field.back()))
+        field.remove_suffix(1);
+
+    if (field == "1-0")
+        return 1.0;
+    if (field == "0-1")
+        return 0.0;
+    if (field == "1/2-1/2")
+        return 0.5;
+
+    double     result = 0.0;
+    const auto parsed = std::from_chars(field.data(), field.data() + field.size(), result);
+    if (field.empty() || parsed.ptr != field.data() + field.size() || result < 0.0 || result > 1.0)
+        throw std::invalid_argument("invalid result: " + std::string(field));
+    return result;
+}
+
+} // namespace
+
+std::optional<LabelledPosition> parse_labelled_position(std::string_view line) {
+    const auto fields = split_fields(line);
+    if (fields.empty() || fields.front().starts_with('#'))
+        return std::nullopt;
+    if (fields.size() < 5)
+        throw std::invalid_argument("expected a FEN followed by a result");
+
+    // EPD records stop after the en-passant field; full FENs add the two move counters.
+    std::string fen;
+    for (std::size_t index = 0; index < 4; ++index)
+        fen.append(fields[index]).push_back(' ');
+    const bool counters = fields.size() > 6 && is_number(fields[4]) && is_number(fields[5]);
+    fen.append(counters ? std::string(fields[4]) + " " + std::string(fields[5]) : "0 1");
+
+    return LabelledPosition{.fen = std::move(fen), .result = parse_result(fields.back())};
+}
+
+void Dataset::add(const eval::LinearFeatures& features, double result) {
+    const std::size_t begin = pool.size();
+    pool.insert(pool.end(), features.coefficients.begin(), features.coefficients.end());
+    entries.push_back({
+        .begin        = begin,
+        .end          = pool.size(),
+        .result       = result,
+        .fixed        = features.fixed,
+        .phase        = features.phase,
+        .scale        = {features.scale[BLACK], features.scale[WHITE]},
+        .side_to_move = features.side_to_move,
+    });
+}
+
+void Dataset::append(const Dataset& other) {
+    const std::size_t offset = pool.size();
+    pool.insert(pool.end(), other.pool.begin(), other.pool.end());
+    for (Sample sample : other.entries) {
+        sample.begin += offset;
+        sample.end += offset;
+        entries.push_back(sample);
+    }
+}
+
+std::span<const eval::FeatureCoefficient> Dataset::coefficients(const Sample& sample) const {
+    return std::span(pool).subspan(sample.begin, sample.end - sample.begin);
+}
+
+Dataset load_dataset(const std::string& path, int threads) {
+    std::ifstream input(path);
+    if (!input)
+        throw std::runtime_error("cannot open dataset: " + path);
+
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(input, line);)
+        lines.push_back(std::move(line));
+
+    // Contiguous chunks keep the merged dataset in file order for any thread count.
+    const std::size_t         workers = std::clamp<std::size_t>(threads, 1, lines.size() + 1);
+    const std::size_t         chunk   = (lines.size() + workers - 1) / workers;
+    std::vector<Dataset>      parts(workers);
+    std::vector<std::string>  errors(workers);
+    std::vector<std::jthread> pool;
+
+    for (std::size_t worker = 0; worker < workers; ++worker) {
+        pool.emplace_back([&, worker] {
+            const std::size_t end = std::min(lines.size(), (worker + 1) * chunk);
+            for (std::size_t index = worker * chunk; index < end; ++index) {
+                try {
+                    const auto position = parse_labelled_position(lines[index]);
+                    if (!position)
+                        continue;
+                    if (const auto features = eval::extract_features(Board(position->fen)))
+                        parts[worker].add(*features, position->result);
+                } catch (const std::exception& error) {
+                    errors[worker] = "invalid dataset line " + std::to_string(index + 1) + " in "
+                                   + path + ": " + error.what();
+                    return;
+                }
+            }
+        });
+    }
+    pool.clear();
+
+    Dataset dataset;
+    for (std::size_t worker = 0; worker < workers; ++worker) {
+        if (!errors[worker].empty())
+            throw std::runtime_error(errors[worker]);
+        dataset.append(parts[worker]);
+    }
+    return dataset;
+}
+
+} // namespace tune
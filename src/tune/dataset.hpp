@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "eval/linear_features.hpp"
+
+namespace tune {
+
+// A FEN with its game result from White's perspective: 1 win, 0.5 draw, 0 loss.
+struct LabelledPosition {
+    std::string fen;
+    double      result;
+};
+
+// Parses one dataset line: a FEN, or an EPD's first four fields, followed by other fields and
+// ending in the result as 1-0, 0-1, 1/2-1/2 or a number in [0, 1], optionally quoted,
+// bracketed or terminated by ';'. Returns nullopt for blank and '#' comment lines; throws
+// std::invalid_argument for anything else it cannot read.
+[[nodiscard]] std::optional<LabelledPosition> parse_labelled_position(std::string_view line);
+
+// One labelled position's linear features, flattened for the tuner's inner loop.
+struct Sample {
+    std::size_t        begin;
+    std::size_t        end;
+    double             result;
+    eval::TaperedScore fixed;
+    int                phase;
+    int                scale[N_COLORS];
+    Color              side_to_move;
+};
+
+// Labelled positions kept in memory as sparse coefficient runs in one shared pool.
+class Dataset {
+public:
+    void add(const eval::LinearFeatures& features, double result);
+    void append(const Dataset& other);
+
+    [[nodiscard]] std::size_t             size() const noexcept { return entries.size(); }
+    [[nodiscard]] std::span<const Sample> samples() const noexcept { return entries; }
+    [[nodiscard]] std::span<const eval::FeatureCoefficient>
+    coefficients(const Sample& sample) const;
+
+private:
+    std::vector<eval::FeatureCoefficient> pool;
+    std::vector<Sample>                   entries;
+};
+
+// Loads every line of path on threads workers, in file order. Known endgames are skipped since
+// no weight moves their value. Throws std::runtime_error naming the first bad line.
+[[nodiscard]] Dataset load_dataset(const std::string& path, int threads);
+
+} // namespace tune
@@ -0,0 +1,198 @@
+#include "tune/texel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <type_traits>
+
+#include "eval/parameters.hpp"
+
+namespace tune {
+
+namespace {
+
+double sigmoid(double k, double value) {
+    return 1.0 / (1.0 + std::exp(-k * value / 400.0));
+}
+
+std::size_t slice_count(std::size_t size, int threads) {
+    return std::clamp<std::size_t>(threads, 1, std::max<std::size_t>(size, 1));
+}
+
+// Runs work(worker, begin, end) over contiguous slices of [0, size) on up to threads workers.
+// Workers must only write state owned by their own slice.
+template <typename Work>
+void for_slices(std::size_t size, int threads, const Work& work) {
+    const std::size_t         workers = slice_count(size, threads);
+    const std::size_t         chunk   = (size + workers - 1) / workers;
+    std::vector<std::jthread> pool;
+    for (std::size_t worker = 0; worker < workers; ++worker) {
+        pool.emplace_back([&, worker] {
+            work(worker, std::min(size, worker * chunk), std::min(size, (worker + 1) * chunk));
+        });
+    }
+}
+
+// Runs work over contiguous slices of [0, size) on up to threads workers and returns each
+// slice's result in slice order.
+template <typename Result, typename Work>
+std::vector<Result> run_slices(std::size_t size, int threads, const Work& work) {
+    static_assert(!std::is_same_v<Result, bool>, "std::vector<bool> elements share words");
+    std::vector<Result> results(slice_count(size, threads));
+    for_slices(size, threads, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+        results[worker] = work(begin, end);
+    });
+    return results;
+}
+
+// Evaluation of sample under weights, plus the derivatives of that evaluation with respect to
+// any middlegame and endgame weight per unit of coefficient.
+struct Prediction {
+    double value;
+    double mg_rate;
+    double eg_rate;
+};
+
+Prediction predict_sample(const Dataset& dataset, const Sample& sample, const Weights& weights) {
+    double mg = sample.fixed.mg();
+    double eg = sample.fixed.eg();
+    for (const eval::FeatureCoefficient coefficient : dataset.coefficients(sample)) {
+        mg += coefficient.value * weights[2 * coefficient.parameter];
+        eg += coefficient.value * weights[2 * coefficient.parameter + 1];
+    }
+
+    const double mg_rate = double(sample.phase) / eval::phase_limit;
+    const double scale   = double(sample.scale[eg < 0 ? BLACK : WHITE]) / eval::scale_limit;
+    const double eg_rate = scale * (1.0 - mg_rate);
+    const double tempo   = sample.side_to_move == WHITE ? eval::tempo_bonus : -eval::tempo_bonus;
+
+    return {mg * mg_rate + eg * eg_rate + tempo, mg_rate, eg_rate};
+}
+
+std::vector<double> predictions(const Dataset& dataset, const Weights& weights, int threads) {
+    const auto          samples = dataset.samples();
+    std::vector<double> values(samples.size());
+    for_slices(samples.size(), threads, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; ++index)
+            values[index] = predict_sample(dataset, samples[index], weights).value;
+    });
+    return values;
+}
+
+double mean_error(const Dataset& dataset, const std::vector<double>& values, double k) {
+    double total = 0.0;
+    for (std::size_t index = 0; index < values.size(); ++index) {
+        const double error = dataset.samples()[index].result - sigmoid(k, values[index]);
+        total += error * error;
+    }
+    return values.empty() ? 0.0 : total / double(values.size());
+}
+
+} // namespace
+
+Weights to_weights(const eval::ParameterVector& parameters) {
+    Weights weights;
+    weights.reserve(2 * parameters.size());
+    for (const eval::TaperedScore score : parameters) {
+        weights.push_back(score.mg());
+        weights.push_back(score.eg());
+    }
+    return weights;
+}
+
+eval::ParameterVector to_parameters(const Weights& weights) {
+    eval::ParameterVector parameters(weights.size() / 2);
+    for (std::size_t index = 0; index < parameters.size(); ++index) {
+        parameters[index] = {EvalValue(std::lround(weights[2 * index])),
+                             EvalValue(std::lround(weights[2 * index + 1]))};
+    }
+    return parameters;
+}
+
+double predict(const Dataset& dataset, const Sample& sample, const Weights& weights) {
+    return predict_sample(dataset, sample, weights).value;
+}
+
+double loss(const Dataset& dataset, const Weights& weights, double k, int threads) {
+    return mean_error(dataset, predictions(dataset, weights, threads), k);
+}
+
+double fit_scaling(const Dataset& dataset, const Weights& weights, int threads) {
+    const std::vector<double> values = predictions(dataset, weights, threads);
+
+    // Golden-section search; the error is unimodal in k for any fixed set of predictions.
+    const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+    double       low   = 0.0;
+    double       high  = 10.0;
+    while (high - low > 1e-6) {
+        const double left  = high - ratio * (high - low);
+        const double right = low + ratio * (high - low);
+        if (mean_error(dataset, values, left) < mean_error(dataset, values, right))
+            high = right;
+        else
+            low = left;
+    }
+    return (low + high) / 2.0;
+}
+
+Weights optimise(const Dataset&                                  dataset,
+                 Weights                                         weights,
+                 double                                          k,
+                 const TunerOptions&                             options,
+                 const std::function<void(int, const Weights&)>& on_epoch) {
+    const auto samples = dataset.samples();
+    if (samples.empty())
+        return weights;
+
+    std::vector<double> first_moment(weights.size());
+    std::vector<double> second_moment(weights.size());
+
+    for (int epoch = 1; epoch <= options.epochs; ++epoch) {
+        const auto slices = run_slices<std::vector<double>>(
+            samples.size(), options.threads, [&](std::size_t begin, std::size_t end) {
+                std::vector<double> gradient(weights.size());
+                for (std::size_t index = begin; index < end; ++index) {
+                    const Sample&    sample     = samples[index];
+                    const Prediction prediction = predict_sample(dataset, sample, weights);
+                    const double     expected   = sigmoid(k, prediction.value);
+
+                    // Derivative of the squared error with respect to the evaluation.
+                    const double slope = 2.0 * (expected - sample.result) * expected
+                                       * (1.0 - expected) * k / 400.0;
+                    for (const eval::FeatureCoefficient coefficient :
+                         dataset.coefficients(sample)) {
+                        gradient[2 * coefficient.parameter] +=
+                            slope * coefficient.value * prediction.mg_rate;
+                        gradient[2 * coefficient.parameter + 1] +=
+                            slope * coefficient.value * prediction.eg_rate;
+                    }
+                }
+                return gradient;
+            });
+
+        const double first_correction  = 1.0 - std::pow(options.beta1, epoch);
+        const double second_correction = 1.0 - std::pow(options.beta2, epoch);
+        for (std::size_t index = 0; index < weights.size(); ++index) {
+            double gradient = 0.0;
+            for (const std::vector<double>& slice : slices)
+                gradient += slice[index];
+            gradient /= double(samples.size());
+
+            first_moment[index] =
+                options.beta1 * first_moment[index] + (1.0 - options.beta1) * gradient;
+            second_moment[index] =
+                options.beta2 * second_moment[index] + (1.0 - options.beta2) * gradient * gradient;
+
+            const double step = first_moment[index] / first_correction;
+            const double scale =
+                std::sqrt(second_moment[index] / second_correction) + options.epsilon;
+            weights[index] -= options.learning_rate * step / scale;
+        }
+
+        if (on_epoch)
+            on_epoch(epoch, weights);
+    }
+    return weights;
+}
+
+} // namespace tune
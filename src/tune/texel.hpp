@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "eval/parameter_vector.hpp"
+#include "tune/dataset.hpp"
+
+namespace tune {
+
+// Real-valued weights for the optimiser: the middlegame and endgame halves of each
+// eval::parameter index at 2 * index and 2 * index + 1.
+using Weights = std::vector<double>;
+
+[[nodiscard]] Weights               to_weights(const eval::ParameterVector& parameters);
+[[nodiscard]] eval::ParameterVector to_parameters(const Weights& weights);
+
+// White-relative evaluation of sample under weights, following the evaluator's scaling,
+// tapering and tempo without integer rounding.
+[[nodiscard]] double predict(const Dataset& dataset, const Sample& sample, const Weights& weights);
+
+// Mean squared error between each result and sigmoid(k * prediction / 400).
+[[nodiscard]] double loss(const Dataset& dataset, const Weights& weights, double k, int threads);
+
+// The k that minimises loss for weights, so evaluation units map onto expected scores.
+[[nodiscard]] double fit_scaling(const Dataset& dataset, const Weights& weights, int threads);
+
+struct TunerOptions {
+    int    epochs        = 1000;
+    double learning_rate = 1.0;
+    double beta1         = 0.9;
+    double beta2         = 0.999;
+    double epsilon       = 1e-8;
+    int    threads       = 1;
+};
+
+// Full-batch Adam over loss. Each thread sums the gradient of one contiguous slice and slices
+// are reduced in order, so a run is reproducible for a given thread count. on_epoch, when set,
+// sees each finished epoch number and the weights after it.
+[[nodiscard]] Weights optimise(const Dataset&                                  dataset,
+                               Weights                                         weights,
+                               double                                          k,
+                               const TunerOptions&                             options,
+                               const std::function<void(int, const Weights&)>& on_epoch = {});
+
+} // namespace tune
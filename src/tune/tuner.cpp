@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "eval/parameter_vector.hpp"
+#include "tune/dataset.hpp"
+#include "tune/texel.hpp"
+
+namespace {
+
+struct TunerArguments {
+    std::string           data;
+    std::string           validation;
+    std::string           parameters;
+    std::string           output;
+    std::optional<double> k;
+    int                   report = 50;
+    tune::TunerOptions    options;
+};
+
+void print_usage(const char* argv0) {
+    std::cerr << "Texel tuning of the handcrafted evaluation's linear weights.\n";
+    std::cerr << "Usage: " << argv0
+              << " --data PATH [--validation PATH] [--parameters PATH] [--output PATH]\n"
+                 "       [--epochs N] [--learning-rate X] [--threads N] [--k X] [--report N]\n";
+}
+
+template <typename Value>
+Value parse_value(std::string_view text, std::string_view option) {
+    Value      value{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || error != std::errc{} || end != text.data() + text.size())
+        throw std::runtime_error("invalid value for " + std::string(option) + ": "
+                                 + std::string(text));
+    return value;
+}
+
+TunerArguments parse_args(int argc, char* argv[]) {
+    TunerArguments arguments;
+    arguments.options.threads = int(std::max(1u, std::thread::hardware_concurrency()));
+
+    for (int index = 1; index < argc; ++index) {
+        const std::string_view argument = argv[index];
+        if (argument == "--help" || argument == "-h") {
+            print_usage(argv[0]);
+            std::exit(0);
+        }
+        if (++index >= argc)
+            throw std::runtime_error("missing value for " + std::string(argument));
+        const std::string_view value = argv[index];
+
+        if (argument == "--data")
+            arguments.data = value;
+        else if (argument == "--validation")
+            arguments.validation = value;
+        else if (argument == "--parameters")
+            arguments.parameters = value;
+        else if (argument == "--output")
+            arguments.output = value;
+        else if (argument == "--epochs")
+            arguments.options.epochs = parse_value<int>(value, argument);
+        else if (argument == "--learning-rate")
+            arguments.options.learning_rate = parse_value<double>(value, argument);
+        else if (argument == "--threads")
+            arguments.options.threads = parse_value<int>(value, argument);
+        else if (argument == "--k")
+            arguments.k = parse_value<double>(value, argument);
+        else if (argument == "--report")
+            arguments.report = parse_value<int>(value, argument);
+        else
+            throw std::runtime_error("unknown argument: " + std::string(argument));
+    }
+
+    if (arguments.data.empty())
+        throw std::runtime_error("missing --data");
+    if (arguments.options.epochs < 0 || arguments.options.threads < 1 || arguments.report < 1)
+        throw std::runtime_error("--epochs, --threads and --report must be positive");
+    return arguments;
+}
+
+eval::ParameterVector initial_parameters(const std::string& path) {
+    if (path.empty())
+        return eval::current_parameters();
+
+    std::ifstream input(path);
+    if (!input)
+        throw std::runtime_error("cannot open parameter file: " + path);
+    return eval::read_parameters(input);
+}
+
+int run(int argc, char* argv[]) {
+    const TunerArguments arguments = parse_args(argc, argv);
+    const int            threads   = arguments.options.threads;
+
+    const tune::Dataset training = tune::load_dataset(arguments.data, threads);
+    const tune::Dataset validation =
+        arguments.validation.empty() ? tune::Dataset{}
+                                     : tune::load_dataset(arguments.validation, threads);
+    std::cerr << "training positions: " << training.size()
+              << ", validation positions: " << validation.size() << '\n';
+
+    tune::Weights weights = tune::to_weights(initial_parameters(arguments.parameters));
+    const double  k       = arguments.k ? *arguments.k
+                                        : tune::fit_scaling(training, weights, threads);
+    std::cerr << std::fixed << std::setprecision(6) << "k: " << k << '\n';
+
+    const auto report = [&](int epoch, const tune::Weights& current) {
+        if (epoch % arguments.report != 0 && epoch != arguments.options.epochs)
+            return;
+        std::cerr << "epoch " << epoch << " training "
+                  << tune::loss(training, current, k, threads);
+        if (validation.size() > 0)
+            std::cerr << " validation " << tune::loss(validation, current, k, threads);
+        std::cerr << '\n';
+    };
+    report(0, weights);
+    weights = tune::optimise(training, std::move(weights), k, arguments.options, report);
+
+    const eval::ParameterVector tuned = tune::to_parameters(weights);
+    if (arguments.output.empty()) {
+        eval::write_parameters(std::cout, tuned);
+    } else {
+        std::ofstream output(arguments.output);
+        if (!output)
+            throw std::runtime_error("cannot write parameter file: " + arguments.output);
+        eval::write_parameters(output, tuned);
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        return run(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << "Error: " << error.what() << '\n';
+        print_usage(argv[0]);
+        return 1;
+    }
+}
@@ -57,7 +57,7 @@ struct ExitCommand {};
 // Latrunculi debug-console extensions. These are not official UCI commands, but
 // they are accepted by the same command loop for local engine inspection.
 struct ConsoleCommand {
-    enum class Name { Help, Board, Eval, Move, Moves, Perft };
+    enum class Name { Help, Board, Eval, Move, Moves, Perft, SaveHash, LoadHash };
 
     Name        name;
     std::string arguments;
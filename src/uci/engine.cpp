@@ -24,7 +24,8 @@ namespace uci {
 Engine::Engine(std::ostream& output, std::ostream& diagnostics, std::istream& input)
     : input(input),
       writer(output, diagnostics),
-      thread_pool(options.threads.value, writer) {}
+      tt(options.hash.value),
+      thread_pool(options.threads.value, writer, tt) {}
 
 void Engine::loop() {
     std::string line;
@@ -105,9 +106,13 @@ bool Engine::handle(const SetOptionCommand& command) {
 bool Engine::handle(const NewGameCommand&) {
     require_idle("start new game");
 
-    // Do not carry search heuristics or TT entries across unrelated games.
+    // Do not carry search heuristics or TT entries across unrelated games. A shared table is
+    // still in use by other processes, so only age its entries rather than wiping it.
     thread_pool.clear_search_heuristics();
-    search::tt.clear();
+    if (tt.page_kind() == search::TTMemory::PageKind::Shared)
+        tt.advance_generation();
+    else
+        tt.clear(thread_pool.thread_count());
     return true;
 }
 
@@ -212,6 +217,10 @@ bool Engine::handle(const ConsoleCommand& command) {
     case ConsoleCommand::Name::Move:  return move(command.arguments);
     case ConsoleCommand::Name::Moves: return moves();
     case ConsoleCommand::Name::Perft: return perft(command.arguments);
+    case ConsoleCommand::Name::SaveHash:
+        return save_hash(hash_file_path(command.arguments, options));
+    case ConsoleCommand::Name::LoadHash:
+        return load_hash(hash_file_path(command.arguments, options));
     }
 
     return true;
@@ -233,6 +242,9 @@ bool Engine::display_board() {
 
 bool Engine::evaluate() {
     writer.diagnostic_line(eval::format_trace(eval::evaluate_trace(board)));
+    if (network)
+        writer.diagnostic_line(
+            std::format("Network evaluation: {}", eval::nnue::evaluate(board, *network)));
     return true;
 }
 
@@ -241,7 +253,18 @@ bool Engine::perft(const std::string& arguments) {
     int                depth;
 
     if (stream >> depth) {
-        writer.diagnostic_text(movegen::format_perft_result(movegen::perft_root(board, depth)));
+        // Split root moves across the Threads option. Subtrees are memoized in a table of their
+        // own size; the search TT stays resident, so perft does not reuse the Hash option.
+        int hash_mb = engine::default_perft_hash_mb;
+        if (int requested; stream >> requested)
+            hash_mb = std::clamp(requested, 0, engine::max_perft_hash_mb);
+
+        const movegen::PerftOptions perft_options{
+            .threads = options.threads.value,
+            .hash_mb = std::size_t(hash_mb),
+        };
+        writer.diagnostic_text(
+            movegen::format_perft_result(movegen::perft_root(board, depth, perft_options)));
     }
 
     return true;
@@ -266,21 +289,32 @@ bool Engine::move(const std::string& arguments) {
 }
 
 bool Engine::moves() {
-    auto movelist = movegen::generate_pseudo_legal(board);
-    for (auto& move : movelist) {
-        if (!board.is_legal_pseudo_move(move))
-            continue;
+    auto movelist = movegen::generate_legal(board);
+    for (auto& move : movelist)
         writer.diagnostic_line(move.str());
-    }
+    return true;
+}
+
+bool Engine::save_hash(const std::string& path) {
+    tt.save(path);
+    writer.info_string("hash saved to " + path);
+    return true;
+}
+
+bool Engine::load_hash(const std::string& path) {
+    tt.load(path);
+    // The loaded table is a private copy at its saved size; report that through the options.
+    options.hash.value = int(tt.capacity_mb());
+    options.shared_hash.value.clear();
+    writer.info_string("hash loaded from " + path);
     return true;
 }
 
 Move Engine::find_legal_move(const Board& position, const std::string& token) const {
-    auto movelist = movegen::generate_pseudo_legal(position);
+    auto movelist = movegen::generate_legal(position);
     for (auto& move : movelist) {
-        if (move.str() == token && position.is_legal_pseudo_move(move)) {
+        if (move.str() == token)
             return move;
-        }
     }
     return NULL_MOVE;
 }
@@ -311,18 +345,63 @@ void Engine::unmake_board_move() {
     board.unmake();
 }
 
-void Engine::apply_option_effect(OptionId option, const Options& candidate) {
+void Engine::apply_option_effect(OptionId option, Options& candidate) {
     switch (option) {
-    case OptionId::Hash: search::tt.resize(candidate.hash.value); break;
+    case OptionId::Hash: size_hash(candidate); break;
     case OptionId::Threads:
         if (!thread_pool.resize(candidate.threads.value))
             throw std::runtime_error("failed to resize thread pool");
         break;
-    case OptionId::Ponder:    break;
-    case OptionId::ClearHash: search::tt.clear(); break;
+    case OptionId::Ponder:     break;
+    case OptionId::ClearHash:  clear_hash(); break;
+    case OptionId::HashFile:   break;
+    case OptionId::SaveHash:   save_hash(hash_file_path("", candidate)); break;
+    case OptionId::SharedHash: size_hash(candidate); break;
+    case OptionId::EvalFile:   load_network(candidate.eval_file.value); break;
+    case OptionId::LoadHash:
+        load_hash(hash_file_path("", candidate));
+        candidate.hash        = options.hash;
+        candidate.shared_hash = options.shared_hash;
+        break;
     }
 }
 
+void Engine::clear_hash() {
+    tt.clear(thread_pool.thread_count());
+    if (tt.page_kind() == search::TTMemory::PageKind::Shared)
+        writer.info_string("shared hash cleared for every attached process");
+}
+
+void Engine::size_hash(const Options& source) {
+    if (source.shared_hash.value.empty())
+        tt.resize(source.hash.value, thread_pool.thread_count());
+    else
+        tt.attach_shared(source.shared_hash.value, source.hash.value, thread_pool.thread_count());
+}
+
+void Engine::load_network(const std::string& path) {
+    // Load first so a bad file leaves the current evaluator in place.
+    std::unique_ptr<eval::nnue::Network> loaded;
+    if (!path.empty())
+        loaded = eval::nnue::Network::load(path);
+
+    // TT entries carry static evaluations that pruning reuses, so they must not outlive their
+    // evaluator. A shared table refuses the change rather than wipe it for other processes.
+    tt.set_evaluator(loaded ? loaded->fingerprint() : search::tt_handcrafted_evaluator,
+                     thread_pool.thread_count());
+    thread_pool.set_network(loaded.get());
+    network = std::move(loaded);
+    writer.info_string(path.empty() ? "using handcrafted evaluation"
+                                    : "network loaded from " + path);
+}
+
+std::string Engine::hash_file_path(const std::string& arguments, const Options& source) const {
+    const std::string& path = arguments.empty() ? source.hash_file.value : arguments;
+    if (path.empty())
+        throw std::runtime_error("missing hash file path");
+    return path;
+}
+
 void Engine::require_idle(std::string_view action) const {
     // Active searches retain their original board and configuration until completion.
     // Lifecycle-safe protocol commands are handled without this guard.
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "board/board.hpp"
+#include "eval/nnue/network.hpp"
 #include "search/thread_pool.hpp"
+#include "search/tt.hpp"
 #include "uci/command.hpp"
 #include "uci/options.hpp"
 #include "uci/writer.hpp"
@@ -50,6 +53,11 @@ private:
     bool perft(const std::string& arguments);
     bool move(const std::string& arguments);
     bool moves();
+    bool save_hash(const std::string& path);
+    bool load_hash(const std::string& path);
+    void clear_hash();
+    void size_hash(const Options& source);
+    void load_network(const std::string& path);
 
     // Board position helpers
     Move              find_legal_move(const Board& position, const std::string& token) const;
@@ -58,15 +66,19 @@ private:
     void              unmake_board_move();
 
     // Option and search helpers
-    void apply_option_effect(OptionId option, const Options& candidate);
-    void require_idle(std::string_view action) const;
+    void        apply_option_effect(OptionId option, Options& candidate);
+    std::string hash_file_path(const std::string& arguments, const Options& source) const;
+    void        require_idle(std::string_view action) const;
 
-    std::istream&      input;
-    Writer             writer;
-    Options            options;
-    bool               debug_mode{false};
-    Board              board;
-    search::ThreadPool thread_pool;
+    std::istream&              input;
+    Writer                     writer;
+    Options                    options;
+    bool                       debug_mode{false};
+    Board                      board;
+    search::TranspositionTable tt;
+    // Loaded EvalFile network, or null for the handcrafted evaluator; outlives the pool.
+    std::unique_ptr<eval::nnue::Network> network;
+    search::ThreadPool                   thread_pool;
 
     friend class ::EngineTest;
 };
@@ -40,6 +40,10 @@ void CheckOption::set(std::string val_str) {
     }
 }
 
+void StringOption::set(std::string val_str) {
+    value = std::move(val_str);
+}
+
 OptionId Options::set(const std::string& name, const std::string& value, bool has_value) {
     const std::string option_name = lower_ascii(name);
 
@@ -47,6 +51,10 @@ OptionId Options::set(const std::string& name, const std::string& value, bool ha
         if (!has_value)
             throw std::invalid_argument(std::string(option) + " requires a value");
     };
+    auto reject_value = [&](std::string_view option) {
+        if (has_value)
+            throw std::invalid_argument(std::string(option) + " does not take a value");
+    };
 
     if (option_name == "hash") {
         require_value("Hash");
@@ -61,9 +69,24 @@ OptionId Options::set(const std::string& name, const std::string& value, bool ha
         ponder.set(value);
         return OptionId::Ponder;
     } else if (option_name == "clear hash") {
-        if (has_value)
-            throw std::invalid_argument("Clear Hash does not take a value");
+        reject_value("Clear Hash");
         return OptionId::ClearHash;
+    } else if (option_name == "hashfile") {
+        require_value("HashFile");
+        hash_file.set(value);
+        return OptionId::HashFile;
+    } else if (option_name == "save hash") {
+        reject_value("Save Hash");
+        return OptionId::SaveHash;
+    } else if (option_name == "load hash") {
+        reject_value("Load Hash");
+        return OptionId::LoadHash;
+    } else if (option_name == "sharedhash") {
+        shared_hash.set(has_value ? value : "");
+        return OptionId::SharedHash;
+    } else if (option_name == "evalfile") {
+        eval_file.set(has_value ? value : "");
+        return OptionId::EvalFile;
     } else {
         throw std::invalid_argument("Unknown UCI option: " + name);
     }
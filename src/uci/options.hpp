@@ -21,9 +21,25 @@ struct CheckOption {
     void set(std::string val_str);
 };
 
+struct StringOption {
+    std::string value;
+    std::string default_value;
+    void        set(std::string val_str);
+};
+
 struct ButtonOption {};
 
-enum class OptionId { Hash, Threads, Ponder, ClearHash };
+enum class OptionId {
+    Hash,
+    Threads,
+    Ponder,
+    ClearHash,
+    HashFile,
+    SaveHash,
+    LoadHash,
+    SharedHash,
+    EvalFile,
+};
 
 struct Options {
     static constexpr int default_threads = 1;
@@ -32,7 +48,7 @@ struct Options {
         .value         = engine::default_hash_mb,
         .default_value = engine::default_hash_mb,
         .min_value     = 1,
-        .max_value     = 2048,
+        .max_value     = engine::max_hash_mb,
     };
 
     SpinOption threads = {
@@ -49,6 +65,17 @@ struct Options {
 
     ButtonOption clear_hash;
 
+    // Path used by the Save Hash and Load Hash buttons.
+    StringOption hash_file;
+    ButtonOption save_hash;
+    ButtonOption load_hash;
+
+    // Shared-memory segment name backing the TT; empty keeps a private table.
+    StringOption shared_hash;
+
+    // Network file evaluated in place of the handcrafted evaluator; empty keeps the latter.
+    StringOption eval_file;
+
     OptionId set(const std::string& name, const std::string& value, bool has_value);
 };
 
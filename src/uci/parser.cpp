@@ -221,6 +221,10 @@ std::optional<Command> try_parse_command(Tokens tokens) {
         return console_command(ConsoleCommand::Name::Moves, tokens);
     if (command == "perft")
         return console_command(ConsoleCommand::Name::Perft, tokens);
+    if (command == "savehash")
+        return console_command(ConsoleCommand::Name::SaveHash, tokens);
+    if (command == "loadhash")
+        return console_command(ConsoleCommand::Name::LoadHash, tokens);
 
     return std::nullopt;
 }
@@ -86,6 +86,12 @@ std::string format_option(std::string_view name, const CheckOption& opt) {
         "option name {} type check default {}", name, opt.default_value ? "true" : "false");
 }
 
+std::string format_option(std::string_view name, const StringOption& opt) {
+    return std::format("option name {} type string default {}",
+                       name,
+                       opt.default_value.empty() ? "<empty>" : opt.default_value);
+}
+
 std::string format_option(std::string_view name, const ButtonOption&) {
     return std::format("option name {} type button", name);
 }
@@ -97,10 +103,20 @@ std::string format_identification(const Options& options) {
                        "{}\n"
                        "{}\n"
                        "{}\n"
+                       "{}\n"
+                       "{}\n"
+                       "{}\n"
+                       "{}\n"
+                       "{}\n"
                        "uciok",
                        engine::version,
                        format_option("Hash", options.hash),
                        format_option("Clear Hash", options.clear_hash),
+                       format_option("HashFile", options.hash_file),
+                       format_option("Save Hash", options.save_hash),
+                       format_option("Load Hash", options.load_hash),
+                       format_option("SharedHash", options.shared_hash),
+                       format_option("EvalFile", options.eval_file),
                        format_option("Threads", options.threads),
                        format_option("Ponder", options.ponder));
 }
@@ -135,20 +151,22 @@ void Writer::write_line(std::ostream& stream, std::string_view text) const {
 void Writer::help() const {
     constexpr auto format_str = R"(
 Available commands:
-  uci           - Show engine identity and supported options
-  isready       - Check if the engine is ready
-  setoption     - Set engine options
-  ucinewgame    - Start a new game
-  position      - Set up the board position
-  go            - Start searching for the best move
-  stop          - Stop the search
-  ponderhit     - Handle ponder hit
-  quit          - Exit the engine
-  perft <depth> - Run perft for the given depth
-  move <move>   - Make a move on the board
-  moves         - Show all legal moves
-  d / board     - Display the current board position
-  eval          - Evaluate the current position)";
+  uci            - Show engine identity and supported options
+  isready        - Check if the engine is ready
+  setoption      - Set engine options
+  ucinewgame     - Start a new game
+  position       - Set up the board position
+  go             - Start searching for the best move
+  stop           - Stop the search
+  ponderhit      - Handle ponder hit
+  quit           - Exit the engine
+  perft <d> [mb] - Run perft on Threads workers with an mb-sized table (default: 16)
+  move <move>    - Make a move on the board
+  moves          - Show all legal moves
+  d / board      - Display the current board position
+  eval           - Evaluate the current position
+  savehash [f]   - Save the hash table to f (default: HashFile option)
+  loadhash [f]   - Load the hash table from f (default: HashFile option))";
     write_line(diagnostics, format_str);
 }
 
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "core/constants.hpp"
+#include "movegen/generator.hpp"
 #include "support/board_fixtures.hpp"
 #include "support/board_snapshot.hpp"
 
@@ -19,10 +20,14 @@ void expect_move_round_trip(std::string_view before, Move move, std::string_view
     board.make(move);
     EXPECT_EQ(board.to_fen(), after);
     EXPECT_EQ(board.key(), board.recompute_key());
+    EXPECT_EQ(board.pawn_key(), board.recompute_pawn_key());
+    EXPECT_EQ(board.material_key(), board.recompute_material_key());
     board_test::expect_base_terms_consistent(board);
 
     board.unmake();
     board_test::expect_same_board_snapshot(board, before_snapshot);
+    EXPECT_EQ(board.pawn_key(), board.recompute_pawn_key());
+    EXPECT_EQ(board.material_key(), board.recompute_material_key());
 }
 
 } // namespace
@@ -244,3 +249,143 @@ TEST(BoardMoveTest, TraversesAndUnwindsBeyondTheSearchDepthReserve) {
     }
     EXPECT_FALSE(board.can_unmake());
 }
+
+TEST(BoardMoveTest, FullPlyStackKeepsTheRepetitionWindowAndASearchLine) {
+    constexpr std::array cycle = {
+        Move(A1, B1),
+        Move(H8, G8),
+        Move(B1, A1),
+        Move(G8, H8),
+    };
+    constexpr int traversal_plies = 3 * Board::ply_capacity;
+
+    Board                                  board(board_test::fen::corner_kings);
+    std::vector<board_test::BoardSnapshot> positions;
+    positions.reserve(traversal_plies);
+
+    for (int ply = 0; ply < traversal_plies; ++ply) {
+        positions.push_back(board_test::snapshot_board(board));
+        board.make(cycle[ply % cycle.size()]);
+        ASSERT_LE(board.history().size(), Board::ply_capacity);
+    }
+
+    EXPECT_EQ(board.key(), board.recompute_key());
+    EXPECT_TRUE(board.is_draw(5));
+
+    ASSERT_GT(board.history().size(), std::size_t(engine::max_search_ply));
+    for (int ply = 0; ply < engine::max_search_ply; ++ply) {
+        board.unmake();
+        board_test::expect_same_board_snapshot(board, positions[traversal_plies - ply - 1]);
+    }
+}
+
+TEST(BoardMoveTest, KeyAfterMatchesKeyAfterMake) {
+    // perft_position_3 is excluded: its e2e4 leaves a pinned en-passant capturer, which
+    // key_after deliberately treats as legal.
+    constexpr std::array fens = {
+        std::string_view{board_test::fen::start},
+        std::string_view{board_test::fen::perft_position_2},
+        std::string_view{board_test::fen::perft_position_4_white},
+        std::string_view{board_test::fen::perft_position_4_black},
+        std::string_view{board_test::fen::perft_position_5},
+        std::string_view{board_test::fen::perft_position_6},
+        std::string_view{board_test::fen::castling},
+        std::string_view{board_test::fen::promotion_options},
+        std::string_view{board_test::fen::capture_promotion},
+        std::string_view{board_test::fen::legal_en_passant_a3},
+        std::string_view{board_test::fen::en_passant_d6_with_clocks},
+    };
+
+    for (std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board board(fen);
+
+        for (Move move : movegen::generate_pseudo_legal(board)) {
+            if (!board.is_legal_pseudo_move(move))
+                continue;
+
+            SCOPED_TRACE(move.str());
+            const PositionKey predicted = board.key_after(move);
+            board.make(move);
+            EXPECT_EQ(predicted, board.key());
+            board.unmake();
+        }
+
+        if (!board.is_check()) {
+            const PositionKey predicted = board.key_after(NULL_MOVE);
+            board.make_null();
+            EXPECT_EQ(predicted, board.key());
+            board.unmake_null();
+        }
+    }
+}
+
+TEST(BoardMoveTest, PawnKeyTracksOnlyPawnPlacement) {
+    constexpr std::array fens = {
+        std::string_view{board_test::fen::start},
+        std::string_view{board_test::fen::perft_position_2},
+        std::string_view{board_test::fen::perft_position_5},
+        std::string_view{board_test::fen::promotion_options},
+        std::string_view{board_test::fen::capture_promotion},
+        std::string_view{board_test::fen::legal_en_passant_a3},
+    };
+
+    for (std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board             board(fen);
+        const PositionKey root_pawn_key = board.pawn_key();
+        EXPECT_EQ(root_pawn_key, board.recompute_pawn_key());
+
+        for (Move move : movegen::generate_pseudo_legal(board)) {
+            if (!board.is_legal_pseudo_move(move))
+                continue;
+
+            SCOPED_TRACE(move.str());
+            const Bitboard white_pawns = board.pieces<PAWN>(WHITE);
+            const Bitboard black_pawns = board.pieces<PAWN>(BLACK);
+            board.make(move);
+            EXPECT_EQ(board.pawn_key(), board.recompute_pawn_key());
+            const bool same_pawns = board.pieces<PAWN>(WHITE) == white_pawns
+                                 && board.pieces<PAWN>(BLACK) == black_pawns;
+            if (same_pawns)
+                EXPECT_EQ(board.pawn_key(), root_pawn_key);
+            board.unmake();
+            EXPECT_EQ(board.pawn_key(), root_pawn_key);
+        }
+
+        if (!board.is_check()) {
+            board.make_null();
+            EXPECT_EQ(board.pawn_key(), root_pawn_key);
+            board.unmake_null();
+        }
+    }
+}
+
+TEST(BoardMoveTest, MaterialKeyChangesOnlyWithPieceCounts) {
+    constexpr std::array fens = {
+        std::string_view{board_test::fen::perft_position_2},
+        std::string_view{board_test::fen::promotion_options},
+        std::string_view{board_test::fen::capture_promotion},
+        std::string_view{board_test::fen::legal_en_passant_a3},
+    };
+
+    for (std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board             board(fen);
+        const PositionKey root_material_key = board.material_key();
+        EXPECT_EQ(root_material_key, board.recompute_material_key());
+
+        for (Move move : movegen::generate_pseudo_legal(board)) {
+            if (!board.is_legal_pseudo_move(move))
+                continue;
+
+            SCOPED_TRACE(move.str());
+            const bool changes_material = board.is_capture(move) || move.type() == MOVE_PROM;
+            board.make(move);
+            EXPECT_EQ(board.material_key(), board.recompute_material_key());
+            EXPECT_EQ(board.material_key() != root_material_key, changes_material);
+            board.unmake();
+            EXPECT_EQ(board.material_key(), root_material_key);
+        }
+    }
+}
@@ -18,8 +18,9 @@ void complete_repetition_cycle(Board& board) {
     board.make(Move(G8, H7));
 }
 
+// Stays within the ply stack even with a search line made on top.
 void build_long_history(Board& board) {
-    constexpr int null_moves_per_segment = 200;
+    constexpr int null_moves_per_segment = 80;
 
     for (int ply = 0; ply < null_moves_per_segment; ++ply)
         board.make_null();
@@ -65,7 +66,7 @@ TEST(BoardRepresentationTest, LoadsRepresentativePositionState) {
     EXPECT_EQ(board.castling_rights(), W_CASTLE);
     EXPECT_EQ(board.checkers(), bb::set(B3));
     EXPECT_EQ(board.base_terms().material(), eval::piece(PAWN, BLACK));
-    EXPECT_LT(board.base_terms().piece_square().mg, 0);
+    EXPECT_LT(board.base_terms().piece_square().mg(), 0);
     EXPECT_EQ(board.key(), board.recompute_key());
 }
 
@@ -121,7 +122,7 @@ TEST(BoardCopyTest, ReplacesRepetitionHistoryWhenDestinationIsReused) {
     board_test::expect_same_board_snapshot(destination, repeated_snapshot);
 }
 
-TEST(BoardCopyTest, CopiesAndUnwindsHistoryAcrossTheGrowthBoundary) {
+TEST(BoardCopyTest, CopiesAndUnwindsLongHistory) {
     Board      source(board_test::fen::start);
     const auto initial = board_test::snapshot_board(source);
     build_long_history(source);
@@ -148,3 +149,38 @@ TEST(BoardCopyTest, CopiesAndUnwindsHistoryAcrossTheGrowthBoundary) {
     board_test::expect_same_board_snapshot(source, initial);
     EXPECT_EQ(source.key(), source.recompute_key());
 }
+
+TEST(BoardCopyTest, SearchRootImportsOnlyTheReachableHistory) {
+    Board source(board_test::fen::start);
+    build_long_history(source);
+    source.make(Move(G8, F6));
+    source.make(Move(G1, F3));
+    source.make(Move(F6, G8));
+    source.make(Move(F3, G1));
+    source.make(Move(G8, F6));
+    ASSERT_EQ(source.halfmove_clock(), 5);
+    ASSERT_TRUE(source.is_draw(5));
+    const auto root = board_test::snapshot_board(source);
+
+    Board destination;
+    for (int ply = 0; ply < engine::max_search_ply; ++ply)
+        destination.make_null();
+
+    destination.assign_search_root(source);
+    board_test::expect_same_board_snapshot(destination, root);
+    EXPECT_EQ(destination.history().size(), 6U);
+    EXPECT_EQ(destination.fullmove_number(), source.fullmove_number());
+    EXPECT_EQ(destination.is_draw(), source.is_draw());
+    EXPECT_EQ(destination.is_draw(5), source.is_draw(5));
+
+    destination.make(Move(G1, F3));
+    destination.make(Move(F6, G8));
+    destination.make(Move(F3, G1));
+    EXPECT_TRUE(destination.is_draw());
+
+    while (destination.can_unmake())
+        destination.unmake();
+    EXPECT_EQ(destination.key(), destination.recompute_key());
+    EXPECT_EQ(destination.previous_move(), Move(G2, G4));
+    board_test::expect_same_board_snapshot(source, root);
+}
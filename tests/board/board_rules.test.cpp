@@ -71,6 +71,44 @@ TEST(BoardRulesTest, DetectsCheckingMoves) {
     EXPECT_FALSE(board.gives_check(Move(G4, H6)));
 }
 
+TEST(BoardRulesTest, CachesCheckSquaresForTheSideToMove) {
+    Board board(board_test::fen::checking_move_candidates);
+    board.make(Move(G4, E3));
+    board.make(Move(E8, F8));
+
+    const Bitboard occupancy = board.occupancy();
+    EXPECT_EQ(board.check_squares(PAWN), attacks::pawn_attacks(F8, BLACK));
+    EXPECT_EQ(board.check_squares(KNIGHT), attacks::piece_moves<KNIGHT>(F8));
+    EXPECT_EQ(board.check_squares(BISHOP), attacks::piece_moves<BISHOP>(F8, occupancy));
+    EXPECT_EQ(board.check_squares(ROOK), attacks::piece_moves<ROOK>(F8, occupancy));
+    EXPECT_EQ(board.check_squares(QUEEN), attacks::piece_moves<QUEEN>(F8, occupancy));
+    EXPECT_EQ(board.check_squares(KING), 0);
+}
+
+TEST(BoardRulesTest, GivesCheckMatchesCheckAfterMake) {
+    constexpr std::string_view fens[] = {board_test::fen::perft_position_2,
+                                         board_test::fen::perft_position_3,
+                                         board_test::fen::perft_position_4_white,
+                                         board_test::fen::perft_position_5,
+                                         board_test::fen::checking_move_candidates,
+                                         board_test::fen::promotion_options};
+
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board board(fen);
+        for (const Move move : movegen::generate_pseudo_legal(board)) {
+            if (!board.is_legal_pseudo_move(move))
+                continue;
+
+            SCOPED_TRACE(move.str());
+            const bool gives_check = board.gives_check(move);
+            board.make(move);
+            EXPECT_EQ(gives_check, board.is_check());
+            board.unmake();
+        }
+    }
+}
+
 TEST(BoardRulesTest, DetectsDiscoveredChecks) {
     Board pieces("Q1N1k3/8/2N1N3/8/B7/8/4R3/4K3 w - - 0 1");
     EXPECT_TRUE(pieces.gives_check(Move(C8, B6)));
@@ -370,3 +408,57 @@ TEST(BoardRulesTest, UnmakeIrreversibleMovePreservesPriorRepetitionHistory) {
     EXPECT_FALSE(board.is_draw());
     EXPECT_TRUE(board.is_draw(5));
 }
+
+TEST(BoardRulesTest, DetectsUpcomingRepetition) {
+    Board board(board_test::fen::corner_kings);
+
+    board.make(Move(A1, B1));
+    board.make(Move(H8, G8));
+    board.make(Move(B1, A1));
+    EXPECT_FALSE(board.has_game_cycle());
+    EXPECT_FALSE(board.has_game_cycle(3));
+    EXPECT_TRUE(board.has_game_cycle(4));
+
+    board.make(Move(G8, H8));
+    board.make(Move(A1, B1));
+    board.make(Move(H8, G8));
+    board.make(Move(B1, A1));
+    EXPECT_TRUE(board.has_game_cycle());
+}
+
+TEST(BoardRulesTest, UpcomingRepetitionNeedsTheOpponentBackAndAClearPath) {
+    constexpr std::array moves = {
+        Move(H8, G8),
+        Move(A1, B1),
+        Move(G8, G7),
+        Move(B1, B3),
+        Move(G7, H7),
+        Move(B3, A3),
+        Move(H7, H8),
+    };
+
+    Board open("7k/8/8/8/8/8/8/R6K b - - 0 1");
+    Board blocked("7k/8/8/8/8/8/P7/R6K b - - 0 1");
+    for (std::size_t ply = 0; ply < moves.size(); ++ply) {
+        open.make(moves[ply]);
+        blocked.make(moves[ply]);
+        if (ply + 1 < moves.size()) {
+            EXPECT_FALSE(open.has_game_cycle(8));
+            EXPECT_FALSE(blocked.has_game_cycle(8));
+        }
+    }
+
+    EXPECT_TRUE(open.has_game_cycle(8));
+    EXPECT_FALSE(open.has_game_cycle(7));
+    EXPECT_FALSE(blocked.has_game_cycle(8));
+}
+
+TEST(BoardRulesTest, UpcomingRepetitionStopsAtNullMoves) {
+    Board board(board_test::fen::corner_kings);
+
+    board.make(Move(A1, B1));
+    board.make_null();
+    board.make(Move(B1, A1));
+    board.make_null();
+    EXPECT_FALSE(board.has_game_cycle(10));
+}
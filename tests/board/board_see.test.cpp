@@ -2,40 +2,68 @@
 
 #include <gtest/gtest.h>
 
+#include "movegen/generator.hpp"
 #include "support/board_fixtures.hpp"
 
 TEST(BoardSeeTest, ValuesAnUndefendedCapture) {
     Board b("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - -");
-    EXPECT_EQ(b.see(Move(E1, E5)), eval::piece(PAWN).mg);
+    EXPECT_EQ(b.see(Move(E1, E5)), eval::piece(PAWN).mg());
 }
 
 TEST(BoardSeeTest, AccountsForTheRecaptureSequence) {
     Board b("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - -");
-    EXPECT_EQ(b.see(Move(D3, E5)), eval::piece(PAWN).mg - eval::piece(KNIGHT).mg);
+    EXPECT_EQ(b.see(Move(D3, E5)), eval::piece(PAWN).mg() - eval::piece(KNIGHT).mg());
 }
 
 TEST(BoardSeeTest, PrefersPawnOverKnightRecapturer) {
     Board b("7k/1B1p4/4p3/P2p4/2P5/2n5/8/K7 w - - 0 1");
-    EXPECT_EQ(b.see(Move(B7, D5)), eval::piece(PAWN).mg - eval::piece(BISHOP).mg);
+    EXPECT_EQ(b.see(Move(B7, D5)), eval::piece(PAWN).mg() - eval::piece(BISHOP).mg());
 }
 
 TEST(BoardSeeTest, HandlesKingRecapture) {
     Board b("8/8/4k3/3p4/3Q4/8/8/K7 w - - 0 1");
-    EXPECT_EQ(b.see(Move(D4, D5)), eval::piece(PAWN).mg - eval::piece(QUEEN).mg);
+    EXPECT_EQ(b.see(Move(D4, D5)), eval::piece(PAWN).mg() - eval::piece(QUEEN).mg());
 }
 
 TEST(BoardSeeTest, DisallowsAttackedKingRecapture) {
     Board b("8/8/4k3/3p4/3Q4/8/8/K2R4 w - - 0 1");
-    EXPECT_EQ(b.see(Move(D4, D5)), eval::piece(PAWN).mg);
+    EXPECT_EQ(b.see(Move(D4, D5)), eval::piece(PAWN).mg());
 }
 
 TEST(BoardSeeTest, AccountsForCapturePromotion) {
     Board b("4k2r/6P1/8/8/8/8/8/K7 w - - 0 1");
     EXPECT_EQ(b.see(Move(G7, H8, MOVE_PROM, QUEEN)),
-              eval::piece(ROOK).mg + eval::piece(QUEEN).mg - eval::piece(PAWN).mg);
+              eval::piece(ROOK).mg() + eval::piece(QUEEN).mg() - eval::piece(PAWN).mg());
 }
 
 TEST(BoardSeeTest, EnPassantUsesPawnVictim) {
     Board b(board_test::fen::legal_en_passant_a3);
-    EXPECT_EQ(b.see(Move(B4, A3, MOVE_EP)), eval::piece(PAWN).mg);
+    EXPECT_EQ(b.see(Move(B4, A3, MOVE_EP)), eval::piece(PAWN).mg());
+}
+
+TEST(BoardSeeTest, ThresholdAgreesWithTheFullExchange) {
+    for (const char* fen : {"1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - -",
+                            "7k/1B1p4/4p3/P2p4/2P5/2n5/8/K7 w - - 0 1",
+                            "8/8/4k3/3p4/3Q4/8/8/K2R4 w - - 0 1",
+                            "4k2r/6P1/8/8/8/8/8/K7 w - - 0 1",
+                            board_test::fen::perft_position_2,
+                            board_test::fen::perft_position_3,
+                            board_test::fen::perft_position_5,
+                            board_test::fen::legal_en_passant_a3}) {
+        Board b(fen);
+        for (Move move : movegen::generate_noisy(b)) {
+            const EvalValue value = b.see(move);
+            EXPECT_TRUE(b.see_ge(move, value)) << fen << ' ' << move;
+            EXPECT_FALSE(b.see_ge(move, value + 1)) << fen << ' ' << move;
+        }
+    }
+}
+
+TEST(BoardSeeTest, ThresholdValuesQuietMovesByWhatTheyHang) {
+    Board b("4k3/8/2p5/8/8/2N5/8/4K3 w - - 0 1");
+    // Nc3-d5 walks into the c6 pawn; Nc3-e4 lands on a square nothing attacks.
+    EXPECT_FALSE(b.see_ge(Move(C3, D5), -eval::piece(KNIGHT).mg() + 1));
+    EXPECT_TRUE(b.see_ge(Move(C3, D5), -eval::piece(KNIGHT).mg()));
+    EXPECT_TRUE(b.see_ge(Move(C3, E4), 0));
+    EXPECT_FALSE(b.see_ge(Move(C3, E4), 1));
 }
@@ -0,0 +1,51 @@
+#include "board/cuckoo.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace {
+
+PositionKey move_key(Color color, PieceType piece_type, Square from, Square to) {
+    return zob::hash_piece(color, piece_type, from) ^ zob::hash_piece(color, piece_type, to)
+         ^ zob::hash_turn();
+}
+
+} // namespace
+
+TEST(CuckooTest, FindsEveryReversibleMoveInBothDirections) {
+    using cuckoo::storage::Table;
+
+    std::size_t found = 0;
+    for (Color color : {BLACK, WHITE}) {
+        for (PieceType piece_type : {KNIGHT, BISHOP, ROOK, QUEEN, KING}) {
+            for (Square from = A1; from < INVALID; ++from) {
+                for (Square to = A1; to < INVALID; ++to) {
+                    if (from == to || !Table::connects(piece_type, from, to))
+                        continue;
+
+                    const Move expected(std::min(from, to), std::max(from, to));
+                    EXPECT_EQ(cuckoo::reversible_move(move_key(color, piece_type, from, to)),
+                              expected);
+                    ++found;
+                }
+            }
+        }
+    }
+
+    EXPECT_EQ(found, 2 * Table::reversible_moves);
+}
+
+TEST(CuckooTest, RejectsKeyChangesOfOtherMoves) {
+    const PositionKey pawn_push = move_key(WHITE, PAWN, E2, E3);
+    const PositionKey knight_jump_without_turn =
+        zob::hash_piece(WHITE, KNIGHT, G1) ^ zob::hash_piece(WHITE, KNIGHT, F3);
+    const PositionKey unreachable_knight = move_key(WHITE, KNIGHT, A1, A3);
+    const PositionKey bishop_on_rank     = move_key(BLACK, BISHOP, A8, H8);
+
+    EXPECT_EQ(cuckoo::reversible_move(pawn_push), NULL_MOVE);
+    EXPECT_EQ(cuckoo::reversible_move(knight_jump_without_turn), NULL_MOVE);
+    EXPECT_EQ(cuckoo::reversible_move(unreachable_knight), NULL_MOVE);
+    EXPECT_EQ(cuckoo::reversible_move(bishop_on_rank), NULL_MOVE);
+    EXPECT_EQ(cuckoo::reversible_move(0), NULL_MOVE);
+}
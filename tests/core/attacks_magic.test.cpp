@@ -1,6 +1,9 @@
 #include "core/attacks_magic.hpp"
 
+#include "core/attacks.hpp"
+#include "core/attacks_pext.hpp"
 #include "core/bitboard.hpp"
+#include "core/slider_attacks.hpp"
 
 #include <gtest/gtest.h>
 
@@ -21,3 +24,54 @@ TEST(MagicAttacksTest, ComputesRookAttacks) {
     EXPECT_EQ(attacks::magic::rook_moves(E4, bb::set(D4, E5, E3, F4)), bb::set(D4, E5, E3, F4));
     EXPECT_EQ(attacks::magic::rook_moves(A1, bb::set(A4, B1)), bb::set(A2, A3, A4, B1));
 }
+
+// The PEXT tables derive their masks from rays; magics carry their own literal masks.
+TEST(MagicAttacksTest, MasksMatchGeneratedRelevantMasks) {
+    constexpr attacks::slider::Rays rays;
+
+    for (Square sq = A1; sq < INVALID; ++sq) {
+        EXPECT_EQ(attacks::magic::rook_mask[sq], rays.relevant_mask(ROOK, sq)) << int(sq);
+        EXPECT_EQ(attacks::magic::bishop_mask[sq], rays.relevant_mask(BISHOP, sq)) << int(sq);
+    }
+}
+
+// Every blocker subset, with unrelated squares filled in, must index the same attacks.
+TEST(PextAttacksTest, MatchesMagicAttacksForEveryBlockerSubset) {
+    if (!attacks::pext::supported)
+        GTEST_SKIP() << "PEXT backend not built or CPU lacks BMI2";
+
+    for (Square sq = A1; sq < INVALID; ++sq) {
+        const Bitboard rook_mask = attacks::magic::rook_mask[sq];
+        Bitboard       occupied  = 0;
+        do {
+            for (Bitboard noise : {Bitboard(0), ~rook_mask}) {
+                ASSERT_EQ(attacks::pext::rook_moves(sq, occupied | noise),
+                          attacks::magic::rook_moves(sq, occupied | noise))
+                    << "rook on " << int(sq);
+            }
+            occupied = (occupied - rook_mask) & rook_mask;
+        } while (occupied);
+
+        const Bitboard bishop_mask = attacks::magic::bishop_mask[sq];
+        occupied                   = 0;
+        do {
+            for (Bitboard noise : {Bitboard(0), ~bishop_mask}) {
+                ASSERT_EQ(attacks::pext::bishop_moves(sq, occupied | noise),
+                          attacks::magic::bishop_moves(sq, occupied | noise))
+                    << "bishop on " << int(sq);
+            }
+            occupied = (occupied - bishop_mask) & bishop_mask;
+        } while (occupied);
+    }
+}
+
+TEST(PextAttacksTest, SelectedBackendMatchesMagicAttacks) {
+    const Bitboard occupied = bb::set(D4, E5, G4, C2, F6, B7);
+
+    EXPECT_TRUE(!attacks::pext::enabled || attacks::pext::supported);
+    EXPECT_EQ(attacks::piece_moves<ROOK>(E4, occupied), attacks::magic::rook_moves(E4, occupied));
+    EXPECT_EQ(attacks::piece_moves<BISHOP>(E4, occupied),
+              attacks::magic::bishop_moves(E4, occupied));
+    EXPECT_EQ(attacks::piece_moves(E4, QUEEN, occupied),
+              attacks::magic::queen_moves(E4, occupied));
+}
@@ -0,0 +1,89 @@
+#include "eval/endgame.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/parameters.hpp"
+#include "support/evaluator_test_access.hpp"
+
+namespace {
+
+EvalValue value_without_tempo(const std::string& fen) {
+    const Board board(fen);
+    return eval::evaluate(board) - eval::tempo_bonus;
+}
+
+} // namespace
+
+TEST(EndgameTest, KPKBitbaseClassifiesKnownPositions) {
+    // King on the sixth in front of its pawn wins with either side to move.
+    EXPECT_TRUE(eval::endgame::kpk_win(WHITE, E6, E5, E8));
+    EXPECT_TRUE(eval::endgame::kpk_win(BLACK, E6, E5, E8));
+    // The pawn promotes before the defending king arrives.
+    EXPECT_TRUE(eval::endgame::kpk_win(WHITE, A1, A7, H8));
+    // Rook pawn with the defending king in the corner.
+    EXPECT_FALSE(eval::endgame::kpk_win(WHITE, A1, A4, A8));
+    // Undefended pawn is captured.
+    EXPECT_FALSE(eval::endgame::kpk_win(BLACK, H1, A2, B2));
+    // Files E-H mirror onto the stored A-D half.
+    EXPECT_TRUE(eval::endgame::kpk_win(WHITE, D6, D5, D8));
+    EXPECT_EQ(eval::endgame::kpk_win(BLACK, H1, H4, H8), eval::endgame::kpk_win(BLACK, A1, A4, A8));
+}
+
+TEST(EndgameTest, KPKEvaluatesWinsAndDrawsForEitherColor) {
+    const std::vector<std::tuple<std::string, bool>> test_cases = {
+        {"4k3/8/4K3/4P3/8/8/8/8 w - - 0 1", true},
+        {"8/8/8/8/4p3/4k3/8/4K3 b - - 0 1", true},
+        {"k7/8/8/8/P7/8/8/K7 w - - 0 1", false},
+        {"k7/8/8/p7/8/8/8/K7 b - - 0 1", false},
+    };
+
+    for (const auto& [fen, won] : test_cases) {
+        const EvalValue value = value_without_tempo(fen);
+        if (won)
+            EXPECT_GT(value, eval::endgame::known_win) << fen;
+        else
+            EXPECT_EQ(value, eval_value::draw) << fen;
+    }
+}
+
+TEST(EndgameTest, KXKDrivesTheBareKingToTheEdge) {
+    const EvalValue corner = value_without_tempo("7k/8/8/8/8/8/8/R3K3 w - - 0 1");
+    const EvalValue centre = value_without_tempo("8/8/8/3k4/8/8/8/R3K3 w - - 0 1");
+
+    EXPECT_GT(corner, eval::endgame::known_win);
+    EXPECT_GT(corner, centre);
+    EXPECT_EQ(value_without_tempo("7K/8/8/8/8/8/8/r3k3 b - - 0 1"), corner);
+    EXPECT_EQ(value_without_tempo("7K/8/8/8/8/8/8/r3k3 w - - 0 1"), -corner);
+}
+
+TEST(EndgameTest, KBNKPrefersTheBishopsCorner) {
+    // Dark-squared bishop on c1: mate is forced in a1 or h8.
+    const EvalValue dark_corner  = value_without_tempo("8/8/8/8/8/3K4/8/k1B1N3 w - - 0 1");
+    const EvalValue light_corner = value_without_tempo("8/8/8/8/8/3K4/8/2B1N2k w - - 0 1");
+
+    EXPECT_GT(light_corner, eval::endgame::known_win);
+    EXPECT_GT(dark_corner, light_corner);
+}
+
+TEST(EndgameTest, InsufficientMaterialIsDrawn) {
+    for (const std::string fen : {"8/8/8/8/8/8/8/k1K3N1 w - - 0 1",
+                                  "8/8/8/8/8/8/8/k1K3B1 b - - 0 1",
+                                  "1n6/8/8/8/8/8/8/k1K3B1 w - - 0 1"}) {
+        EXPECT_EQ(value_without_tempo(fen), eval_value::draw) << fen;
+    }
+}
+
+TEST(EndgameTest, OppositeColoredBishopsScaleByPassedPawns) {
+    const Board opposite("4k3/8/8/1b6/8/8/3P4/4K1B1 w - - 0 1");
+    const Board same("4k3/8/8/2b5/8/8/3P4/4K1B1 w - - 0 1");
+
+    EXPECT_EQ(EvaluatorTestAccess::scale_factor(opposite, WHITE), 24);
+    EXPECT_EQ(EvaluatorTestAccess::scale_factor(same, WHITE),
+              eval::scale_base + eval::scale_per_pawn);
+}
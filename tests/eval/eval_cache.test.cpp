@@ -0,0 +1,156 @@
+#include "eval/eval_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string_view>
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/material_table.hpp"
+#include "eval/parameters.hpp"
+#include "eval/pawn_table.hpp"
+#include "movegen/generator.hpp"
+#include "support/board_fixtures.hpp"
+
+namespace {
+
+class EvalCacheTest : public ::testing::Test {
+protected:
+    eval::CachedEvaluation evaluate_cached(const Board& board) {
+        return eval::evaluate_cached(board, eval_cache, pawn_table, material_table);
+    }
+
+    eval::CachedEvaluation evaluate_lazy(const Board& board, EvalValue alpha, EvalValue beta) {
+        return eval::evaluate_lazy(board, alpha, beta, eval_cache, pawn_table, material_table);
+    }
+
+    eval::EvalCache     eval_cache;
+    eval::PawnTable     pawn_table;
+    eval::MaterialTable material_table;
+};
+
+} // namespace
+
+TEST_F(EvalCacheTest, MissesThenHitsWithTheUncachedValue) {
+    const Board board(board_test::fen::perft_position_2);
+
+    const eval::CachedEvaluation first = evaluate_cached(board);
+    EXPECT_FALSE(first.hit);
+    EXPECT_EQ(first.value, eval::evaluate(board));
+
+    const eval::CachedEvaluation second = evaluate_cached(board);
+    EXPECT_TRUE(second.hit);
+    EXPECT_EQ(second.value, first.value);
+}
+
+TEST_F(EvalCacheTest, SideToMoveIsPartOfTheKey) {
+    Board board(board_test::fen::perft_position_2);
+    (void)evaluate_cached(board);
+
+    board.make_null();
+    const eval::CachedEvaluation after_null = evaluate_cached(board);
+    EXPECT_FALSE(after_null.hit);
+    EXPECT_EQ(after_null.value, eval::evaluate(board));
+}
+
+TEST_F(EvalCacheTest, ChildrenMatchUncachedEvaluation) {
+    constexpr std::string_view fens[] = {
+        board_test::fen::start,
+        board_test::fen::perft_position_5,
+        board_test::fen::castling,
+    };
+
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board board(fen);
+
+        for (int pass = 0; pass < 2; ++pass) {
+            for (Move move : movegen::generate_pseudo_legal(board)) {
+                if (!board.is_legal_pseudo_move(move))
+                    continue;
+
+                SCOPED_TRACE(move.str());
+                board.make(move);
+                const eval::CachedEvaluation cached = evaluate_cached(board);
+                EXPECT_EQ(cached.value, eval::evaluate(board));
+                if (pass == 1)
+                    EXPECT_TRUE(cached.hit);
+                board.unmake();
+            }
+        }
+    }
+}
+
+TEST_F(EvalCacheTest, ClearForgetsEntries) {
+    const Board board(board_test::fen::start);
+    (void)evaluate_cached(board);
+
+    eval_cache.clear();
+    EXPECT_FALSE(evaluate_cached(board).hit);
+}
+
+TEST_F(EvalCacheTest, LazyEvaluationInsideTheMarginIsExactAndCached) {
+    const Board     board(board_test::fen::perft_position_2);
+    const EvalValue value = eval::evaluate(board);
+
+    const eval::CachedEvaluation lazy = evaluate_lazy(board, value - 1, value + 1);
+    EXPECT_TRUE(lazy.exact);
+    EXPECT_FALSE(lazy.hit);
+    EXPECT_EQ(lazy.value, value);
+    EXPECT_TRUE(evaluate_cached(board).hit);
+}
+
+TEST_F(EvalCacheTest, LazyEvaluationReturnsWidenedEstimatesFarOutsideTheWindow) {
+    // White is a queen up; only material decides whether stand pat fails high or low.
+    constexpr char  queen_up[] = "4k3/pppp4/8/8/8/8/PPPP4/3QK3 w - - 0 1";
+    const Board     board(queen_up);
+    const EvalValue base  = eval::evaluate_base(board);
+    const EvalValue value = eval::evaluate(board);
+
+    const eval::CachedEvaluation high = evaluate_lazy(board, -1, 0);
+    EXPECT_FALSE(high.exact);
+    EXPECT_EQ(high.value, base - eval::lazy_margin);
+    EXPECT_GE(value, high.value);
+
+    const EvalValue              alpha = base + eval::lazy_margin;
+    const eval::CachedEvaluation low   = evaluate_lazy(board, alpha, alpha + 1);
+    EXPECT_FALSE(low.exact);
+    EXPECT_EQ(low.value, alpha);
+    EXPECT_LE(value, low.value);
+
+    // Lazy estimates are never cached as static evaluations.
+    EXPECT_FALSE(evaluate_cached(board).hit);
+}
+
+TEST_F(EvalCacheTest, LazyEvaluationNeverShortcutsKnownEndgames) {
+    // KQK is a known win, valued well beyond its material.
+    constexpr char kqk[] = "4k3/8/8/8/8/8/8/3QK3 w - - 0 1";
+    const Board    board(kqk);
+
+    const eval::CachedEvaluation lazy = evaluate_lazy(board, -1, 0);
+    EXPECT_TRUE(lazy.exact);
+    EXPECT_EQ(lazy.value, eval::evaluate(board));
+}
+
+TEST(EvalBaseTest, StaysWithinTheLazyMarginOfTheFullEvaluation) {
+    constexpr std::string_view fens[] = {
+        board_test::fen::start,
+        board_test::fen::after_e2e4,
+        board_test::fen::perft_position_2,
+        board_test::fen::perft_position_3,
+        board_test::fen::perft_position_4_white,
+        board_test::fen::perft_position_5,
+        board_test::fen::perft_position_6,
+    };
+
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        const Board board(fen);
+        EXPECT_LE(std::abs(eval::evaluate(board) - eval::evaluate_base(board)), eval::lazy_margin);
+    }
+}
+
+TEST(EvalBaseTest, SymmetricPositionIsWorthTheTempo) {
+    EXPECT_EQ(eval::evaluate_base(Board(board_test::fen::start)), eval::tempo_bonus);
+}
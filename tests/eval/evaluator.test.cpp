@@ -3,8 +3,11 @@
 #include <gtest/gtest.h>
 
 #include "board/board.hpp"
+#include "eval/material_table.hpp"
 #include "eval/parameters.hpp"
+#include "eval/pawn_table.hpp"
 #include "eval/trace_formatter.hpp"
+#include "movegen/generator.hpp"
 #include "support/board_fixtures.hpp"
 
 TEST(EvaluatorTest, Evaluate) {
@@ -22,8 +25,9 @@ TEST(EvaluatorTest, Evaluate) {
 }
 
 TEST(EvaluatorTest, SideToMoveOnlyChangesPerspectiveAndTempo) {
-    const Board white_to_move(board_test::fen::white_pawn_e2);
-    const Board black_to_move("4k3/8/8/8/8/8/4P3/4K3 b - - 0 1");
+    // Two pawns keep the position out of the KPK bitbase, whose result depends on the mover.
+    const Board white_to_move("4k3/8/8/8/8/8/3PP3/4K3 w - - 0 1");
+    const Board black_to_move("4k3/8/8/8/8/8/3PP3/4K3 b - - 0 1");
 
     const int white_eval = eval::evaluate(white_to_move);
     const int black_eval = eval::evaluate(black_to_move);
@@ -34,7 +38,7 @@ TEST(EvaluatorTest, SideToMoveOnlyChangesPerspectiveAndTempo) {
 }
 
 TEST(EvaluatorTest, NullMoveOnlyChangesPerspectiveAndTempo) {
-    Board board(board_test::fen::white_pawn_e2);
+    Board board("4k3/8/8/8/8/8/3PP3/4K3 w - - 0 1");
 
     const int white_eval = eval::evaluate(board);
     board.make_null();
@@ -88,3 +92,38 @@ TEST(EvaluatorTest, TraceMatchesNormalEvaluationAndFormatsStableTermBreakdown) {
     EXPECT_NE(output.find("Mobility"), std::string::npos);
     EXPECT_NE(output.find("Evaluation:"), std::string::npos);
 }
+
+TEST(EvaluatorTest, TableEvaluationMatchesUncachedEvaluation) {
+    constexpr std::string_view fens[] = {
+        board_test::fen::start,
+        board_test::fen::perft_position_2,
+        board_test::fen::perft_position_5,
+        board_test::fen::castling,
+        "6k1/8/2p5/4pNp1/3nP1P1/2P5/8/6K1 w - - 0 1",
+        "4k3/8/8/1b6/8/8/3P4/4K1B1 w - - 0 1",
+        "8/8/8/8/8/3K4/1P6/k1B1N3 w - - 0 1",
+    };
+
+    eval::PawnTable     pawn_table;
+    eval::MaterialTable material_table;
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board board(fen);
+        EXPECT_EQ(eval::evaluate(board, pawn_table, material_table), eval::evaluate(board));
+
+        // Children share table entries with the root and each other, including king moves and
+        // castling-right changes that must refresh the cached shelter.
+        for (Move move : movegen::generate_pseudo_legal(board)) {
+            if (!board.is_legal_pseudo_move(move))
+                continue;
+
+            SCOPED_TRACE(move.str());
+            board.make(move);
+            const EvalValue uncached = eval::evaluate(board);
+            EXPECT_EQ(eval::evaluate(board, pawn_table, material_table), uncached);
+            EXPECT_EQ(eval::evaluate(board, pawn_table, material_table), uncached);
+            board.unmake();
+            EXPECT_EQ(eval::evaluate(board, pawn_table, material_table), eval::evaluate(board));
+        }
+    }
+}
@@ -150,7 +150,7 @@ TEST_F(EvaluationFeaturesTest, MobilityZone) {
 
 TEST_F(EvaluationFeaturesTest, MobilityScore) {
     std::vector<std::tuple<std::string, eval::TaperedScore>> test_cases = {
-        {board_test::fen::kings_only, {0}},
+        {board_test::fen::kings_only, eval::TaperedScore::Zero},
         // no mobility area restriction
         {"3nk3/8/8/8/8/8/8/3NK3 w - - 0 1", eval::knight_mob[4]},
         {"3bk3/8/8/8/8/8/8/3BK3 w - - 0 2", eval::bishop_mob[7]},
@@ -381,7 +381,7 @@ TEST_F(EvaluationFeaturesTest, KingSafety) {
     const auto  current_shelter = EvaluatorTestAccess::shelter<WHITE>(with_rights, E1);
     const auto  castled_shelter = EvaluatorTestAccess::shelter<WHITE>(with_rights, G1);
 
-    ASSERT_GT(castled_shelter.mg, current_shelter.mg);
+    ASSERT_GT(castled_shelter.mg(), current_shelter.mg());
     const auto with_rights_score = eval::evaluate_trace(with_rights).term(eval::Term::King).white;
     const auto without_rights_score =
         eval::evaluate_trace(without_rights).term(eval::Term::King).white;
@@ -461,9 +461,12 @@ TEST_F(EvaluationFeaturesTest, RawDanger) {
 
 TEST_F(EvaluationFeaturesTest, ScaleFactor) {
     std::vector<std::pair<std::string, int>> test_cases = {
-        {board_test::fen::kings_only, 48},
+        {board_test::fen::kings_only, 0},
         {board_test::fen::start, eval::scale_limit},
         {"4k3/8/8/8/8/8/4P3/4K3 w K - 0 1", 52}, // Single pawn
+        {"4k3/8/8/8/8/8/8/rR2K3 w - - 0 1", 14}, // Equal rooks
+        {"4k3/8/8/8/8/8/8/bR2K3 w - - 0 1", 4},  // Rook against bishop
+        {"4k3/8/8/8/8/8/8/2N1KN2 w - - 0 1", 0}, // Two knights cannot force mate
     };
 
     for (const auto& [fen, expected] : test_cases) {
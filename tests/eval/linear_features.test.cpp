@@ -0,0 +1,80 @@
+#include "eval/linear_features.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string_view>
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "movegen/generator.hpp"
+#include "support/board_fixtures.hpp"
+
+namespace parameter = eval::parameter;
+
+TEST(LinearFeaturesTest, FeaturesReconstructTheEvaluation) {
+    constexpr std::string_view fens[] = {
+        board_test::fen::start,
+        board_test::fen::perft_position_2,
+        board_test::fen::perft_position_4_black,
+        board_test::fen::perft_position_5,
+        board_test::fen::perft_position_6,
+        board_test::fen::castling,
+        "4k3/1b6/8/3p4/3P4/8/1B6/4K3 w - - 0 1",
+    };
+
+    const eval::ParameterVector weights = eval::current_parameters();
+    for (const std::string_view fen : fens) {
+        Board root(fen);
+        for (Move move : movegen::generate_pseudo_legal(root)) {
+            if (!root.is_legal_pseudo_move(move))
+                continue;
+
+            root.make(move);
+            SCOPED_TRACE(root.to_fen());
+            const auto features = eval::extract_features(root);
+            ASSERT_TRUE(features);
+
+            const eval::Trace trace = eval::evaluate_trace(root);
+            EXPECT_EQ(eval::linear_score(*features, weights), trace.unscaled_score());
+            EXPECT_EQ(eval::linear_value(*features, weights), eval::evaluate(root));
+            root.unmake();
+        }
+    }
+}
+
+TEST(LinearFeaturesTest, CoefficientsAreSparseAscendingAndWhiteRelative) {
+    const auto features = eval::extract_features(Board(board_test::fen::start));
+    ASSERT_TRUE(features);
+
+    EXPECT_TRUE(std::ranges::is_sorted(features->coefficients, {}, [](auto coefficient) {
+        return coefficient.parameter;
+    }));
+    EXPECT_TRUE(std::ranges::none_of(features->coefficients, [](auto coefficient) {
+        return coefficient.value == 0;
+    }));
+
+    EXPECT_LT(features->coefficients.size(), 8u);
+    EXPECT_EQ(features->fixed, eval::TaperedScore::Zero);
+    EXPECT_EQ(features->phase, eval::phase_limit);
+}
+
+TEST(LinearFeaturesTest, CoefficientsCountEachSidesUses) {
+    // Only White has a bishop pair and an isolated pawn.
+    const auto features = eval::extract_features(Board("r3k3/8/8/8/8/8/P7/2B1KB2 w - - 0 1"));
+    ASSERT_TRUE(features);
+
+    const auto coefficient = [&](std::size_t index) {
+        const auto found = std::ranges::find(
+            features->coefficients, index, &eval::FeatureCoefficient::parameter);
+        return found == features->coefficients.end() ? 0 : found->value;
+    };
+    EXPECT_EQ(coefficient(parameter::bishop_pair), 1);
+    EXPECT_EQ(coefficient(parameter::iso_pawn), 1);
+    EXPECT_EQ(coefficient(parameter::doubled_pawn), 0);
+}
+
+TEST(LinearFeaturesTest, KnownEndgamesHaveNoLinearFeatures) {
+    EXPECT_FALSE(eval::extract_features(Board(board_test::fen::white_pawn_e2)));
+    EXPECT_FALSE(eval::extract_features(Board(board_test::fen::kings_only)));
+}
@@ -0,0 +1,70 @@
+#include "eval/material_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "board/board.hpp"
+#include "eval/parameters.hpp"
+#include "support/board_fixtures.hpp"
+
+TEST(MaterialTableTest, ProbeReusesEntryForEqualMaterial) {
+    eval::MaterialTable table;
+    const Board         board(board_test::fen::start);
+    const Board         moved("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1");
+
+    eval::MaterialEntry& entry = table.probe(board);
+    EXPECT_EQ(entry.key, board.material_key());
+    EXPECT_EQ(&table.probe(moved), &entry);
+    EXPECT_EQ(entry.phase, eval::phase_limit);
+    EXPECT_EQ(entry.evaluation, nullptr);
+    EXPECT_EQ(entry.scaling, nullptr);
+}
+
+TEST(MaterialTableTest, AnalyseComputesPhaseAndScale) {
+    const eval::MaterialEntry kings =
+        eval::MaterialTable::analyse(Board(board_test::fen::kings_only));
+    EXPECT_EQ(kings.phase, 0);
+
+    const Board               pawns("4k3/pp6/8/8/8/8/PPP5/4K3 w - - 0 1");
+    const eval::MaterialEntry entry = eval::MaterialTable::analyse(pawns);
+    EXPECT_EQ(entry.scale[WHITE], eval::scale_base + 3 * eval::scale_per_pawn);
+    EXPECT_EQ(entry.scale[BLACK], eval::scale_base + 2 * eval::scale_per_pawn);
+
+    // Pawnless edges of at most a minor piece scale toward a draw.
+    const eval::MaterialEntry rooks =
+        eval::MaterialTable::analyse(Board("4k3/8/8/8/8/8/8/rR2K3 w - - 0 1"));
+    EXPECT_EQ(rooks.scale[WHITE], 14);
+    const eval::MaterialEntry rook_bishop =
+        eval::MaterialTable::analyse(Board("4k3/8/8/8/8/8/8/bR2K3 w - - 0 1"));
+    EXPECT_EQ(rook_bishop.scale[WHITE], 4);
+    EXPECT_EQ(rook_bishop.scale[BLACK], 0);
+}
+
+TEST(MaterialTableTest, AnalyseDispatchesKnownEndgames) {
+    const std::vector<std::tuple<std::string, eval::EndgameEval, Color>> test_cases = {
+        {"4k3/8/8/8/8/8/8/R3K3 w - - 0 1", eval::endgame::kxk, WHITE},
+        {"4k3/8/8/8/8/8/8/Q3K1N1 w - - 0 1", eval::endgame::kxk, WHITE},
+        {"4k3/8/8/8/8/8/4p3/4K3 w - - 0 1", eval::endgame::kpk, BLACK},
+        {"4k3/8/8/8/8/8/8/2B1KN2 w - - 0 1", eval::endgame::kbnk, WHITE},
+        {"4k3/8/8/8/8/8/8/4KN2 w - - 0 1", eval::endgame::draw, WHITE},
+        {board_test::fen::kings_only, eval::endgame::draw, WHITE},
+        {"4k3/8/8/8/8/8/8/3NKN2 w - - 0 1", eval::endgame::draw, WHITE},
+        {"4k3/8/8/8/8/8/3PP3/4K3 w - - 0 1", nullptr, WHITE},
+        {"4k3/8/8/8/8/8/4P3/3NK3 w - - 0 1", nullptr, WHITE},
+    };
+
+    for (const auto& [fen, evaluation, strong_side] : test_cases) {
+        const eval::MaterialEntry entry = eval::MaterialTable::analyse(Board(fen));
+        EXPECT_EQ(entry.evaluation, evaluation) << fen;
+        if (evaluation && evaluation != eval::endgame::draw)
+            EXPECT_EQ(entry.strong_side, strong_side) << fen;
+    }
+
+    const eval::MaterialEntry bishops =
+        eval::MaterialTable::analyse(Board("4k3/8/8/1b6/8/8/3P4/4K1B1 w - - 0 1"));
+    EXPECT_EQ(bishops.evaluation, nullptr);
+    EXPECT_EQ(bishops.scaling, eval::endgame::opposite_bishops);
+}
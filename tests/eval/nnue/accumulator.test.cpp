@@ -0,0 +1,120 @@
+#include "eval/nnue/accumulator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "board/board.hpp"
+#include "eval/nnue/network.hpp"
+#include "movegen/generator.hpp"
+#include "support/board_fixtures.hpp"
+#include "support/nnue_fixtures.hpp"
+
+using namespace eval::nnue;
+
+namespace {
+
+std::vector<Move> legal_moves(const Board& board) {
+    std::vector<Move> moves;
+    for (Move move : movegen::generate_pseudo_legal(board))
+        if (board.is_legal_pseudo_move(move))
+            moves.push_back(move);
+    return moves;
+}
+
+void expect_matches_refresh(const Accumulator& accumulator,
+                            const Board&       board,
+                            const Network&     network) {
+    Accumulator expected;
+    AccumulatorStack::refresh(expected, board, network);
+    for (Color perspective : {BLACK, WHITE})
+        ASSERT_TRUE(std::equal(std::begin(accumulator.values[perspective]),
+                               std::end(accumulator.values[perspective]),
+                               std::begin(expected.values[perspective])))
+            << board.to_fen();
+}
+
+} // namespace
+
+TEST(NNUEAccumulatorTest, DirtyPiecesRecordEachPlacementChange) {
+    Board board(board_test::fen::capture_promotion);
+    board.make(Move(A7, B8, MOVE_PROM, QUEEN));
+
+    const PlyState& state = board.history().back();
+    ASSERT_EQ(state.dirty_count, 4);
+    EXPECT_EQ(state.dirty_pieces[0].piece, B_KNIGHT);
+    EXPECT_EQ(state.dirty_pieces[0].to, INVALID);
+    EXPECT_EQ(state.dirty_pieces[1].from, A7);
+    EXPECT_EQ(state.dirty_pieces[1].to, B8);
+    EXPECT_EQ(state.dirty_pieces[2].piece, W_PAWN);
+    EXPECT_EQ(state.dirty_pieces[3].piece, W_QUEEN);
+    EXPECT_EQ(state.dirty_pieces[3].from, INVALID);
+
+    board.make_null();
+    EXPECT_EQ(board.history().back().dirty_count, 0);
+}
+
+TEST(NNUEAccumulatorTest, IncrementalUpdatesMatchRefreshAlongRandomLines) {
+    const auto network = nnue_test::random_network();
+
+    constexpr std::string_view fens[] = {
+        board_test::fen::start,
+        board_test::fen::perft_position_2,
+        board_test::fen::perft_position_3,
+        board_test::fen::perft_position_4_white,
+        board_test::fen::perft_position_5,
+        board_test::fen::promotion_options,
+    };
+
+    std::mt19937 engine(3);
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board            board(fen);
+        AccumulatorStack accumulators;
+
+        // Wander down, back up, and down again so siblings replace stale entries.
+        for (int line = 0; line < 20; ++line) {
+            int made = 0;
+            for (int ply = 0; ply < 16; ++ply) {
+                const std::vector<Move> moves = legal_moves(board);
+                if (moves.empty())
+                    break;
+                if (ply % 5 == 4 && !board.is_check()) {
+                    board.make_null();
+                } else {
+                    board.make(moves[engine() % moves.size()]);
+                }
+                ++made;
+                expect_matches_refresh(accumulators.update(board, *network), board, *network);
+            }
+
+            const int keep = line % 3 == 0 ? 0 : made / 2;
+            for (; made > keep; --made) {
+                if (board.previous_move().is_null())
+                    board.unmake_null();
+                else
+                    board.unmake();
+                expect_matches_refresh(accumulators.update(board, *network), board, *network);
+            }
+        }
+    }
+}
+
+TEST(NNUEAccumulatorTest, DistantAncestorsFallBackToRefresh) {
+    const auto       network = nnue_test::random_network();
+    Board            board;
+    AccumulatorStack accumulators;
+    (void)accumulators.update(board, *network);
+
+    std::mt19937 engine(11);
+    for (std::size_t ply = 0; ply < 2 * AccumulatorStack::max_replay; ++ply) {
+        const std::vector<Move> moves = legal_moves(board);
+        ASSERT_FALSE(moves.empty());
+        board.make(moves[engine() % moves.size()]);
+    }
+
+    expect_matches_refresh(accumulators.update(board, *network), board, *network);
+}
@@ -0,0 +1,161 @@
+#include "eval/nnue/network.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "board/board.hpp"
+#include "eval/eval_cache.hpp"
+#include "eval/nnue/kernels.hpp"
+#include "support/board_fixtures.hpp"
+#include "support/nnue_fixtures.hpp"
+
+using namespace eval::nnue;
+
+namespace {
+
+std::string temporary_network_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST(NNUEFeatureTest, IndicesMirrorBetweenPerspectives) {
+    EXPECT_EQ(feature_index(WHITE, W_PAWN, E2), feature_index(BLACK, B_PAWN, E7));
+    EXPECT_EQ(feature_index(WHITE, B_KING, E8), feature_index(BLACK, W_KING, E1));
+    EXPECT_NE(feature_index(WHITE, W_PAWN, E2), feature_index(WHITE, B_PAWN, E2));
+    EXPECT_EQ(feature_index(BLACK, W_KING, H8), (piece_slots + piece_slot(KING)) * N_SQUARES + H1);
+}
+
+TEST(NNUEKernelTest, EverySupportedKernelMatchesScalar) {
+    std::mt19937                       engine(7);
+    std::uniform_int_distribution<int> wide(-400, 400);
+    std::uniform_int_distribution<int> byte(-128, 127);
+
+    std::array<std::int16_t, accumulator_size> us{};
+    std::array<std::int16_t, accumulator_size> them{};
+    std::array<std::int16_t, accumulator_size> row{};
+    std::array<std::int8_t, hidden_input>      weights{};
+    for (std::size_t i = 0; i < accumulator_size; ++i) {
+        us[i]   = std::int16_t(wide(engine));
+        them[i] = std::int16_t(wide(engine));
+        row[i]  = std::int16_t(wide(engine));
+    }
+    for (auto& weight : weights)
+        weight = std::int8_t(byte(engine));
+
+    const Kernels& scalar = supported_kernels().front();
+    ASSERT_STREQ(scalar.name, "scalar");
+
+    auto expected_sum = us;
+    scalar.add_row(expected_sum.data(), row.data());
+    auto expected_difference = us;
+    scalar.sub_row(expected_difference.data(), row.data());
+    std::array<std::uint8_t, hidden_input> expected_input{};
+    scalar.activate(expected_input.data(), us.data(), them.data());
+    const std::int32_t expected_dot = scalar.dot(expected_input.data(), weights.data());
+
+    for (const Kernels& kernels : supported_kernels()) {
+        SCOPED_TRACE(kernels.name);
+
+        auto sum = us;
+        kernels.add_row(sum.data(), row.data());
+        EXPECT_EQ(sum, expected_sum);
+
+        auto difference = us;
+        kernels.sub_row(difference.data(), row.data());
+        EXPECT_EQ(difference, expected_difference);
+
+        std::array<std::uint8_t, hidden_input> input{};
+        kernels.activate(input.data(), us.data(), them.data());
+        EXPECT_EQ(input, expected_input);
+        EXPECT_TRUE(std::ranges::all_of(input, [](std::uint8_t value) {
+            return value <= activation_max;
+        }));
+
+        EXPECT_EQ(kernels.dot(input.data(), weights.data()), expected_dot);
+    }
+}
+
+TEST(NNUENetworkTest, SaveAndLoadRoundTrip) {
+    const auto        network = nnue_test::random_network();
+    const std::string path    = temporary_network_path("latrunculi_network_roundtrip.nnue");
+    network->save(path);
+
+    const auto loaded = Network::load(path);
+    EXPECT_EQ(loaded->feature_biases, network->feature_biases);
+    EXPECT_EQ(loaded->feature_weights, network->feature_weights);
+    EXPECT_EQ(loaded->hidden_biases, network->hidden_biases);
+    EXPECT_EQ(loaded->hidden_weights, network->hidden_weights);
+    EXPECT_EQ(loaded->output_bias, network->output_bias);
+    EXPECT_EQ(loaded->output_weights, network->output_weights);
+
+    const Board board(board_test::fen::perft_position_2);
+    EXPECT_EQ(evaluate(board, *loaded), evaluate(board, *network));
+
+    std::filesystem::remove(path);
+}
+
+TEST(NNUENetworkTest, FingerprintIdentifiesParameters) {
+    const auto network = nnue_test::random_network(1);
+    auto       changed = nnue_test::random_network(1);
+
+    EXPECT_EQ(network->fingerprint(), changed->fingerprint());
+    changed->output_weights[0] ^= 1;
+    EXPECT_NE(network->fingerprint(), changed->fingerprint());
+    EXPECT_NE(network->fingerprint(), nnue_test::random_network(2)->fingerprint());
+}
+
+TEST(NNUENetworkTest, LoadRejectsMissingForeignAndTruncatedFiles) {
+    const std::string path = temporary_network_path("latrunculi_network_invalid.nnue");
+    std::filesystem::remove(path);
+    EXPECT_THROW((void)Network::load(path), std::runtime_error);
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "definitely not a network file";
+    }
+    EXPECT_THROW((void)Network::load(path), std::runtime_error);
+
+    nnue_test::random_network()->save(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_THROW((void)Network::load(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+TEST(NNUENetworkTest, ValueDependsOnSideToMove) {
+    const auto network = nnue_test::random_network();
+    Board      board(board_test::fen::perft_position_2);
+
+    Accumulator accumulator;
+    AccumulatorStack::refresh(accumulator, board, *network);
+    EXPECT_EQ(evaluate(board, *network), network->evaluate(accumulator, WHITE));
+
+    board.make_null();
+    EXPECT_EQ(evaluate(board, *network), network->evaluate(accumulator, BLACK));
+}
+
+TEST(NNUENetworkTest, CachedEvaluationMatchesAndHits) {
+    const auto       network = nnue_test::random_network();
+    const Board      board(board_test::fen::perft_position_5);
+    eval::EvalCache  eval_cache;
+    AccumulatorStack accumulators;
+
+    const eval::CachedEvaluation first =
+        evaluate_cached(board, eval_cache, accumulators, *network);
+    EXPECT_FALSE(first.hit);
+    EXPECT_EQ(first.value, evaluate(board, *network));
+
+    const eval::CachedEvaluation second =
+        evaluate_cached(board, eval_cache, accumulators, *network);
+    EXPECT_TRUE(second.hit);
+    EXPECT_EQ(second.value, first.value);
+}
@@ -0,0 +1,100 @@
+#include "eval/parameter_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "eval/linear_features.hpp"
+#include "support/board_fixtures.hpp"
+
+using eval::ParameterVector;
+using eval::TaperedScore;
+namespace parameter = eval::parameter;
+
+TEST(ParameterVectorTest, GroupsTileTheVectorInOrder) {
+    std::size_t           offset = 0;
+    std::set<std::string> names;
+    for (const eval::ParameterGroup& group : eval::parameter_groups()) {
+        EXPECT_EQ(group.offset, offset) << group.name;
+        EXPECT_GT(group.size, 0u) << group.name;
+        EXPECT_TRUE(names.emplace(group.name).second) << group.name;
+        offset += group.size;
+    }
+    EXPECT_EQ(offset, parameter::count);
+}
+
+TEST(ParameterVectorTest, CurrentParametersMirrorTheEvaluatorWeights) {
+    const ParameterVector weights = eval::current_parameters();
+    ASSERT_EQ(weights.size(), parameter::count);
+
+    EXPECT_EQ(weights[parameter::iso_pawn], eval::iso_pawn);
+    EXPECT_EQ(weights[parameter::passed_pawn + 6], eval::passed_pawn[6]);
+    EXPECT_EQ(weights[parameter::pawn_storm + 7 + 2], eval::pawn_storm[1][2]);
+    EXPECT_EQ(weights[parameter::king_open_file + 2 * 1 + 0], eval::king_open_file[1][0]);
+    EXPECT_EQ(weights[parameter::mobility[QUEEN] + 27], eval::queen_mob[27]);
+
+    for (Square square : {A1, E4, H8}) {
+        SCOPED_TRACE(square);
+        const std::size_t index = parameter::psqt + piece_slot(KNIGHT) * N_SQUARES + square;
+        EXPECT_EQ(weights[index], eval::piece_sq(KNIGHT, WHITE, square));
+    }
+}
+
+TEST(ParameterVectorTest, WrittenFilesReadBackExactly) {
+    ParameterVector weights = eval::current_parameters();
+    weights[parameter::bishop_pair] = {12, -34};
+    weights[parameter::psqt + 100]  = {-7, 9};
+    weights[parameter::count - 1]   = {0, 1};
+
+    std::stringstream file;
+    eval::write_parameters(file, weights);
+    EXPECT_EQ(eval::read_parameters(file), weights);
+}
+
+TEST(ParameterVectorTest, PartialFilesOverrideOnlyTheirEntries) {
+    std::istringstream file("# experiment\n"
+                            "\n"
+                            "bishop_pair 0 61 90  # pair\n"
+                            "passed_pawn 6 85 170\n");
+
+    ParameterVector expected             = eval::current_parameters();
+    expected[parameter::bishop_pair]     = {61, 90};
+    expected[parameter::passed_pawn + 6] = {85, 170};
+    EXPECT_EQ(eval::read_parameters(file), expected);
+}
+
+TEST(ParameterVectorTest, MalformedFilesAreRejected) {
+    for (const std::string text : {"no_such_group 0 1 2", "passed_pawn 8 1 2", "iso_pawn 0 1",
+                                   "iso_pawn 0 1 2 3", "iso_pawn zero 1 2"}) {
+        SCOPED_TRACE(text);
+        std::istringstream file(text);
+        EXPECT_THROW((void)eval::read_parameters(file), std::runtime_error);
+    }
+}
+
+TEST(ParameterVectorTest, AppliedParametersDriveEvaluationWhenTunable) {
+    const ParameterVector original  = eval::current_parameters();
+    ParameterVector       changed   = original;
+    changed[parameter::bishop_pair] = {150, 250};
+
+    if constexpr (!eval::tunable) {
+        EXPECT_THROW(eval::apply_parameters(changed), std::runtime_error);
+        EXPECT_THROW(eval::load_parameters("/nonexistent/parameters.txt"), std::runtime_error);
+        return;
+    }
+
+    eval::apply_parameters(changed);
+    const Board board(board_test::fen::perft_position_2);
+    const auto  features = eval::extract_features(board);
+    ASSERT_TRUE(features);
+    EXPECT_EQ(eval::current_parameters(), changed);
+    EXPECT_EQ(eval::evaluate(board), eval::linear_value(*features, changed));
+
+    eval::apply_parameters(original);
+    EXPECT_EQ(eval::evaluate(board), eval::linear_value(*features, original));
+}
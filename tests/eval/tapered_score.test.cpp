@@ -2,6 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
+
 TEST(TaperedScoreTest, Operations) {
     eval::TaperedScore a{3, 4};
     eval::TaperedScore b{1, 2};
@@ -26,3 +29,25 @@ TEST(TaperedScoreTest, AssignmentOperators) {
     a *= 2;
     EXPECT_EQ(a, (eval::TaperedScore{6, 10}));
 }
+
+TEST(TaperedScoreTest, HalvesUnpackWithMixedSigns) {
+    constexpr EvalValue max = std::numeric_limits<std::int16_t>::max() * 4;
+
+    for (EvalValue mg : {-max, -1, 0, 1, max}) {
+        for (EvalValue eg : {-max, -1, 0, 1, max}) {
+            const eval::TaperedScore score{mg, eg};
+            EXPECT_EQ(score.mg(), mg);
+            EXPECT_EQ(score.eg(), eg);
+
+            const eval::TaperedScore sum =
+                score + eval::TaperedScore{-mg, 7} - eval::TaperedScore{5, eg};
+            EXPECT_EQ(sum.mg(), -5);
+            EXPECT_EQ(sum.eg(), 7);
+            EXPECT_EQ((score * -3).mg(), mg * -3);
+            EXPECT_EQ((score * -3).eg(), eg * -3);
+        }
+    }
+
+    static_assert(eval::TaperedScore(-3, 5).mg() == -3);
+    static_assert(eval::TaperedScore(-3, 5).eg() == 5);
+}
@@ -1,14 +1,6 @@
 #include <gtest/gtest.h>
 
-#include "core/attacks.hpp"
-
-class GlobalTestSetup : public ::testing::Environment {
-public:
-    void SetUp() override { attacks::init(); }
-};
-
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
-    ::testing::AddGlobalTestEnvironment(new GlobalTestSetup());
     return RUN_ALL_TESTS();
 }
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <iterator>
 #include <string_view>
 #include <vector>
@@ -33,6 +34,31 @@ bool are_disjoint(const std::vector<MoveBits>& lhs, const std::vector<MoveBits>&
     return intersection.empty();
 }
 
+std::vector<MoveBits> sorted_legal_subset(const Board& board, const movegen::MoveList& movelist) {
+    std::vector<MoveBits> bits;
+    for (const Move& move : movelist) {
+        if (board.is_legal_pseudo_move(move))
+            bits.push_back(move.bits);
+    }
+    std::sort(bits.begin(), bits.end());
+    return bits;
+}
+
+void expect_legal_lists_match_filtered_lists(const Board& board) {
+    EXPECT_EQ(sorted_move_bits(movegen::generate_legal(board)),
+              sorted_legal_subset(board, movegen::generate_pseudo_legal(board)));
+
+    if (board.is_check()) {
+        EXPECT_EQ(sorted_move_bits(movegen::generate_legal_evasions(board)),
+                  sorted_legal_subset(board, movegen::generate_evasions(board)));
+    } else {
+        EXPECT_EQ(sorted_move_bits(movegen::generate_legal_noisy(board)),
+                  sorted_legal_subset(board, movegen::generate_noisy(board)));
+        EXPECT_EQ(sorted_move_bits(movegen::generate_legal_quiet(board)),
+                  sorted_legal_subset(board, movegen::generate_quiet(board)));
+    }
+}
+
 std::vector<MoveBits> sorted_union(std::vector<MoveBits> lhs, const std::vector<MoveBits>& rhs) {
     lhs.insert(lhs.end(), rhs.begin(), rhs.end());
     std::sort(lhs.begin(), lhs.end());
@@ -119,3 +145,56 @@ TEST(MoveGeneratorTest, DoubleCheckEvasionsContainOnlyKingMoves) {
     for (const Move move : evasions)
         EXPECT_EQ(move.from(), E8) << move;
 }
+
+TEST(MoveGeneratorTest, LegalListsMatchFilteredPseudoLegalLists) {
+    constexpr std::array fens = {
+        board_test::fen::start,
+        board_test::fen::perft_position_2,
+        board_test::fen::perft_position_3,
+        board_test::fen::perft_position_4_white,
+        board_test::fen::perft_position_4_black,
+        board_test::fen::perft_position_5,
+        board_test::fen::perft_position_6,
+        board_test::fen::pinned_en_passant_e3,
+        board_test::fen::check_evasion,
+        "R3k3/8/8/8/8/8/4Q3/4K3 b - - 0 1",
+        "7k/2K5/8/2Ppb3/8/8/8/8 w - d6 0 1",
+    };
+
+    // Two plies from each root reach pins, checks, and king walks the roots alone do not.
+    for (const std::string_view fen : fens) {
+        SCOPED_TRACE(fen);
+        Board board{fen};
+        expect_legal_lists_match_filtered_lists(board);
+        for (const Move move : movegen::generate_legal(board)) {
+            board.make(move);
+            expect_legal_lists_match_filtered_lists(board);
+            for (const Move reply : movegen::generate_legal(board)) {
+                board.make(reply);
+                expect_legal_lists_match_filtered_lists(board);
+                board.unmake();
+            }
+            board.unmake();
+        }
+    }
+}
+
+TEST(MoveGeneratorTest, ScoredListsAppendNoisyThenQuietMoves) {
+    const Board             board{board_test::fen::perft_position_2};
+    movegen::ScoredMoveList scored;
+
+    movegen::generate_legal_noisy(board, scored);
+    const std::size_t noisy_count = scored.size();
+    movegen::generate_legal_quiet(board, scored);
+
+    const movegen::MoveList noisy = movegen::generate_legal_noisy(board);
+    const movegen::MoveList quiet = movegen::generate_legal_quiet(board);
+    ASSERT_EQ(noisy_count, noisy.size());
+    ASSERT_EQ(scored.size(), noisy.size() + quiet.size());
+
+    // Appending keeps generation order, so the picker sees the same moves in the same slots.
+    for (int i = 0; i < int(noisy.size()); ++i)
+        EXPECT_EQ(scored[i].move, noisy[i]);
+    for (int i = 0; i < int(quiet.size()); ++i)
+        EXPECT_EQ(scored[int(noisy_count) + i].move, quiet[i]);
+}
@@ -75,3 +75,20 @@ TEST(MoveListTest, MoveAssignmentPreservesActiveRange) {
     EXPECT_EQ(target[0], Move(A2, A3));
     EXPECT_EQ(target[1], Move(B2, B3));
 }
+
+TEST(MoveListTest, ScoredListAddsZeroScoresAndCopiesScores) {
+    movegen::ScoredMoveList source;
+    source.add(E2, E4);
+    source.add(G1, F3);
+
+    ASSERT_EQ(source.size(), 2U);
+    EXPECT_EQ(source[0].move, Move(E2, E4));
+    EXPECT_EQ(source[0].score, 0);
+
+    source[1].score = 42;
+    const movegen::ScoredMoveList copy(source);
+
+    ASSERT_EQ(copy.size(), 2U);
+    EXPECT_EQ(copy[1].move, Move(G1, F3));
+    EXPECT_EQ(copy[1].score, 42);
+}
@@ -1,6 +1,7 @@
 #include "movegen/perft.hpp"
 
 #include <array>
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -66,6 +67,29 @@ TEST(PerftTest, ChessProgrammingPositionsMatchExpectedDepths) {
     }
 }
 
+TEST(PerftTest, ThreadedHashedCountsMatchExpectedDepths) {
+    const movegen::PerftOptions options{.threads = 3, .hash_mb = 1};
+
+    for (const auto& position : perft_positions) {
+        Board board(position.fen);
+
+        for (int depth = 1; depth <= static_cast<int>(position.expected.size()); ++depth) {
+            const NodeCount result = movegen::perft(board, depth, options);
+            EXPECT_EQ(result, position.expected[depth - 1])
+                << position.fen << " at depth " << depth;
+        }
+    }
+}
+
+TEST(PerftTest, ThreadedRootKeepsMoveOrder) {
+    Board board(board_test::fen::perft_position_2);
+
+    const movegen::PerftResult serial   = movegen::perft_root(board, 3);
+    const movegen::PerftResult threaded = movegen::perft_root(board, 3, {.threads = 4});
+
+    EXPECT_EQ(movegen::format_perft_result(threaded), movegen::format_perft_result(serial));
+}
+
 TEST(PerftTest, DepthZeroReturnsOne) {
     Board board(board_test::fen::start);
 
@@ -96,6 +120,14 @@ TEST(PerftTest, RejectsInvalidDepths) {
     EXPECT_THROW(movegen::perft_root(board, engine::max_search_ply + 1), std::invalid_argument);
 }
 
+TEST(PerftTest, RejectsInvalidOptions) {
+    Board board(board_test::fen::start);
+
+    EXPECT_THROW(movegen::perft(board, 1, {.threads = 0}), std::invalid_argument);
+    EXPECT_THROW(movegen::perft(board, 1, {.hash_mb = std::size_t(engine::max_hash_mb) + 1}),
+                 std::invalid_argument);
+}
+
 TEST(PerftTest, RestoresBoardState) {
     Board      board(board_test::fen::perft_position_2);
     const auto original = board_test::snapshot_board(board);
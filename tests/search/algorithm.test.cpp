@@ -27,15 +27,13 @@ namespace {
 class SearchTest : public ::testing::Test {
 protected:
     RecordingSearchReporter reporter;
-    ThreadPool              pool{1, reporter};
+    TranspositionTable      tt;
+    ThreadPool              pool{1, reporter, tt};
     Thread&                 thread{SearchThreadTestAccess::thread(pool)};
     Worker&                 worker{SearchThreadTestAccess::worker(thread)};
     Limits                  limits;
 
-    void SetUp() override {
-        limits.depth = 4;
-        tt.clear();
-    }
+    void SetUp() override { limits.depth = 4; }
 
     void load(const Board& board, int depth = 4) {
         tt.clear();
@@ -164,6 +162,22 @@ TEST_F(SearchTest, HandlesDrawAndMaxPlyExits) {
     EXPECT_EQ(search(-eval_value::inf, eval_value::inf, 1), eval_value::draw);
 }
 
+TEST_F(SearchTest, UpcomingRepetitionRaisesAlphaToDraw) {
+    Board board{"7k/5q2/8/8/8/8/8/K7 w - - 0 1"};
+    board.make(Move(A1, B1));
+    board.make(Move(H8, G8));
+    board.make(Move(B1, A1));
+
+    // Black can return to the start position; the repeat only counts inside the search tree.
+    load(board);
+    ply() = 4;
+    EXPECT_EQ(search(-100, -50, 1), eval_value::draw);
+
+    load(board);
+    ply() = 3;
+    EXPECT_GT(search(-100, -50, 1), eval_value::draw);
+}
+
 TEST_F(SearchTest, ReturnsFailSoftValues) {
     constexpr auto one_evasion = board_test::fen::one_legal_evasion;
     constexpr int  depth       = 1;
@@ -518,6 +532,29 @@ TEST_F(SearchTest, FutilityKeepsTacticalMoves) {
     }
 }
 
+TEST_F(SearchTest, SeePruningSkipsOnlyQuietsThatHangMaterial) {
+    struct Case {
+        Move quiet;
+        bool pruned;
+    };
+    // Nc3-d5 walks into the c6 pawn; Nc3-e4 is safe.
+    constexpr std::array cases{Case{Move(C3, D5), true}, Case{Move(C3, E4), false}};
+
+    for (const auto& tc : cases) {
+        SCOPED_TRACE(tc.pruned ? "hanging" : "safe");
+        Board board{"4k3/8/2p5/8/8/2N5/8/4K3 w - - 0 1"};
+        load(board, 2);
+        const EvalValue alpha = eval::evaluate(position()) - 50;
+        const EvalValue beta  = alpha + 300;
+        tt.store(position().key(), Move(E1, D1), 0, 0, TTBound::Exact, ply());
+        store_child(tc.quiet, -(beta + 100), 1);
+        if (tc.pruned)
+            EXPECT_LT(search(alpha, beta, 2, false), beta);
+        else
+            EXPECT_GE(search(alpha, beta, 2, false), beta);
+    }
+}
+
 TEST_F(SearchTest, QuietCutoffUpdatesPreviousMoveContext) {
     Board board{board_test::fen::start};
     load(board, 2);
@@ -29,12 +29,16 @@ TEST(Instrumentation, DisabledInstrumentationIsEmptyAndNoop) {
     stats.razor_try(1);
     stats.razor_cutoff(1);
     stats.futility_skip(1);
+    stats.see_skip(1);
     stats.lmr_try(1);
     stats.lmr_research(1);
     stats.quiet_cutoff(1);
     stats.quiet_malus_eligible_node(1);
     stats.quiet_malus_failed_quiet(1);
     stats.quiet_malus_update(1);
+    stats.eval_cache_hit(1);
+    stats.eval_cache_miss(1);
+    stats.lazy_eval_exit(1);
     stats.reset();
     stats += other;
 
@@ -67,12 +71,16 @@ TEST(Instrumentation, RecordsRetainedEventFamiliesAndResets) {
     stats.razor_try(index);
     stats.razor_cutoff(index);
     stats.futility_skip(index);
+    stats.see_skip(index);
     stats.lmr_try(index);
     stats.lmr_research(index);
     stats.quiet_cutoff(index);
     stats.quiet_malus_eligible_node(index);
     stats.quiet_malus_failed_quiet(index);
     stats.quiet_malus_update(index);
+    stats.eval_cache_hit(index);
+    stats.eval_cache_miss(index);
+    stats.lazy_eval_exit(index);
 
     const auto& counters = stats.raw_counters();
     EXPECT_EQ(counters.nodes[index], 2);
@@ -96,12 +104,16 @@ TEST(Instrumentation, RecordsRetainedEventFamiliesAndResets) {
     EXPECT_EQ(counters.razor_tries[index], 1);
     EXPECT_EQ(counters.razor_cutoffs[index], 1);
     EXPECT_EQ(counters.futility_skips[index], 1);
+    EXPECT_EQ(counters.see_skips[index], 1);
     EXPECT_EQ(counters.lmr_tries[index], 1);
     EXPECT_EQ(counters.lmr_researches[index], 1);
     EXPECT_EQ(counters.quiet_cutoffs[index], 1);
     EXPECT_EQ(counters.quiet_malus_eligible_nodes[index], 1);
     EXPECT_EQ(counters.quiet_malus_failed_quiets[index], 1);
     EXPECT_EQ(counters.quiet_malus_updates[index], 1);
+    EXPECT_EQ(counters.eval_cache_hits[index], 1);
+    EXPECT_EQ(counters.eval_cache_misses[index], 1);
+    EXPECT_EQ(counters.lazy_eval_exits[index], 1);
 
     stats.reset();
 
@@ -111,6 +123,8 @@ TEST(Instrumentation, RecordsRetainedEventFamiliesAndResets) {
     EXPECT_EQ(reset.main_tt_probes[index], 0);
     EXPECT_EQ(reset.null_move_tries[index], 0);
     EXPECT_EQ(reset.quiet_malus_updates[index], 0);
+    EXPECT_EQ(reset.eval_cache_hits[index], 0);
+    EXPECT_EQ(reset.lazy_eval_exits[index], 0);
     EXPECT_EQ(reset.aspiration_fail_lows, 0);
     EXPECT_EQ(reset.aspiration_fail_highs, 0);
 }
@@ -157,12 +171,16 @@ TEST(Instrumentation, AggregatesCounters) {
     first.razor_tries[1]                = 4;
     first.razor_cutoffs[1]              = 2;
     first.futility_skips[1]             = 7;
+    first.see_skips[1]                  = 3;
     first.lmr_tries[1]                  = 8;
     first.lmr_researches[1]             = 4;
     first.quiet_cutoffs[1]              = 3;
     first.quiet_malus_eligible_nodes[1] = 4;
     first.quiet_malus_failed_quiets[1]  = 5;
     first.quiet_malus_updates[1]        = 6;
+    first.eval_cache_hits[1]            = 7;
+    first.eval_cache_misses[1]          = 2;
+    first.lazy_eval_exits[1]            = 1;
     first.aspiration_fail_lows          = 1;
     first.aspiration_fail_highs         = 2;
 
@@ -185,12 +203,16 @@ TEST(Instrumentation, AggregatesCounters) {
     second.razor_tries[1]                = 9;
     second.razor_cutoffs[1]              = 6;
     second.futility_skips[1]             = 11;
+    second.see_skips[1]                  = 4;
     second.lmr_tries[1]                  = 12;
     second.lmr_researches[1]             = 3;
     second.quiet_cutoffs[1]              = 7;
     second.quiet_malus_eligible_nodes[1] = 8;
     second.quiet_malus_failed_quiets[1]  = 9;
     second.quiet_malus_updates[1]        = 10;
+    second.eval_cache_hits[1]            = 11;
+    second.eval_cache_misses[1]          = 4;
+    second.lazy_eval_exits[1]            = 2;
     second.aspiration_fail_lows          = 4;
     second.aspiration_fail_highs         = 5;
 
@@ -217,12 +239,16 @@ TEST(Instrumentation, AggregatesCounters) {
     EXPECT_EQ(counters.razor_tries[1], 13);
     EXPECT_EQ(counters.razor_cutoffs[1], 8);
     EXPECT_EQ(counters.futility_skips[1], 18);
+    EXPECT_EQ(counters.see_skips[1], 7);
     EXPECT_EQ(counters.lmr_tries[1], 20);
     EXPECT_EQ(counters.lmr_researches[1], 7);
     EXPECT_EQ(counters.quiet_cutoffs[1], 10);
     EXPECT_EQ(counters.quiet_malus_eligible_nodes[1], 12);
     EXPECT_EQ(counters.quiet_malus_failed_quiets[1], 14);
     EXPECT_EQ(counters.quiet_malus_updates[1], 16);
+    EXPECT_EQ(counters.eval_cache_hits[1], 18);
+    EXPECT_EQ(counters.eval_cache_misses[1], 6);
+    EXPECT_EQ(counters.lazy_eval_exits[1], 3);
     EXPECT_EQ(counters.aspiration_fail_lows, 5);
     EXPECT_EQ(counters.aspiration_fail_highs, 7);
 }
@@ -262,6 +288,7 @@ TEST(Instrumentation, FormatsStableDiagnostics) {
     counters.razor_cutoffs[2]              = 2;
     counters.futility_skips[1]             = 5;
     counters.futility_skips[2]             = 6;
+    counters.see_skips[2]                  = 9;
     counters.lmr_tries[1]                  = 8;
     counters.lmr_researches[1]             = 2;
     counters.lmr_tries[2]                  = 12;
@@ -270,14 +297,20 @@ TEST(Instrumentation, FormatsStableDiagnostics) {
     counters.quiet_malus_eligible_nodes[4] = 7;
     counters.quiet_malus_failed_quiets[4]  = 8;
     counters.quiet_malus_updates[4]        = 5;
+    counters.eval_cache_hits[1]            = 30;
+    counters.eval_cache_hits[2]            = 15;
+    counters.eval_cache_misses[2]          = 15;
+    counters.lazy_eval_exits[2]            = 6;
 
     const Instrumentation<true> stats{counters};
 
     EXPECT_EQ(stats.str(), R"(
 Aspiration: fail-low=1 fail-high=2 re-searches=3
 NullMove: tries=10 cutoffs=4 cutoff-rate=40.0%
-RazorFutility: razor-tries=10 razor-cutoffs=4 razor-cutoff-rate=40.0% futility-skips=11
+RazorFutility: razor-tries=10 razor-cutoffs=4 razor-cutoff-rate=40.0% futility-skips=11 see-skips=9
 LMR: tries=20 re-searches=5 re-search-rate=25.0%
+EvalCache: hits=45 misses=15 hit-rate=75.0%
+LazyEval: exits=6 miss-exit-rate=40.0%
 QuietHistory: quiet-cutoffs=6 malus-eligible=7 failed-quiets=8 malus-updates=5
  QH D |       Cutoffs |      Eligible |   FailedQuiet |   MalusUpdate
     4 |             6 |             7 |             8 |             5
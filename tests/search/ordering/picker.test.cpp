@@ -105,11 +105,12 @@ bool expected_good_noisy(const Board& board, Move move) {
 
 } // namespace
 
-TEST_F(PickerTest, MainSearchReturnsEveryPseudoLegalMoveOnce) {
+TEST_F(PickerTest, MainSearchReturnsEveryLegalMoveOnce) {
     for (std::string_view fen : {std::string_view{board_test::fen::start},
                                  std::string_view{board_test::fen::perft_position_2},
                                  std::string_view{board_test::fen::perft_position_3},
                                  std::string_view{board_test::fen::legal_en_passant_a3},
+                                 std::string_view{board_test::fen::pinned_en_passant_e3},
                                  std::string_view{board_test::fen::promotion_options},
                                  std::string_view{board_test::fen::capture_promotion},
                                  std::string_view{board_test::fen::castling}}) {
@@ -118,7 +119,7 @@ TEST_F(PickerTest, MainSearchReturnsEveryPseudoLegalMoveOnce) {
         ASSERT_FALSE(position.is_check());
 
         const auto picked    = picked_main_search(position, state, ply);
-        const auto generated = movegen::generate_pseudo_legal(position);
+        const auto generated = movegen::generate_legal(position);
         EXPECT_EQ(sorted_move_bits(picked), sorted_move_bits(generated));
     }
 }
@@ -248,7 +249,7 @@ TEST_F(PickerTest, MainSearchInCheckReturnsEvasionsAndIgnoresNonEvasionHints) {
 
         const auto baseline = picked_main_search(position, state, ply);
         EXPECT_EQ(sorted_move_bits(baseline),
-                  sorted_move_bits(movegen::generate_evasions(position)));
+                  sorted_move_bits(movegen::generate_legal_evasions(position)));
         EXPECT_EQ(picked_main_search(position, state, ply, non_evasion), baseline);
     }
     {
@@ -302,7 +303,7 @@ TEST_F(PickerTest, QSearchReturnsOnlyNonLosingNoisyMoves) {
 
         const auto        moves = picked_qsearch(position, state);
         movegen::MoveList expected;
-        for (const Move move : movegen::generate_noisy(position)) {
+        for (const Move move : movegen::generate_legal_noisy(position)) {
             if (expected_good_noisy(position, move))
                 expected.add(move);
         }
@@ -342,7 +343,7 @@ TEST_F(PickerTest, QSearchInCheckReturnsEvasionsAndPrioritizesLegalTtHint) {
 
     const auto moves = picked_qsearch(position, state, quiet_evasion);
     expect_hash_move_first_once(moves, quiet_evasion);
-    EXPECT_EQ(sorted_move_bits(moves), sorted_move_bits(movegen::generate_evasions(position)));
+    EXPECT_EQ(sorted_move_bits(moves), sorted_move_bits(movegen::generate_legal_evasions(position)));
 }
 
 TEST_F(PickerTest, QSearchAndEvasionsIgnoreContinuationHistory) {
@@ -401,7 +402,7 @@ TEST_F(PickerTest, SkipQuietMovesIsNoOpForQSearchAndEvasions) {
         auto       picker  = Picker::for_main_search(position, state, context, ply);
         picker.skip_quiet_moves();
         EXPECT_EQ(sorted_move_bits(collect_moves(picker)),
-                  sorted_move_bits(movegen::generate_evasions(position)));
+                  sorted_move_bits(movegen::generate_legal_evasions(position)));
     }
 }
 
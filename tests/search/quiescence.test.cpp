@@ -22,14 +22,12 @@ namespace {
 class QuiescenceTest : public ::testing::Test {
 protected:
     RecordingSearchReporter reporter;
-    ThreadPool              pool{1, reporter};
+    TranspositionTable      tt;
+    ThreadPool              pool{1, reporter, tt};
     Worker&                 worker{SearchThreadTestAccess::worker(pool)};
     Limits                  limits;
 
-    void SetUp() override {
-        limits.depth = 4;
-        tt.clear();
-    }
+    void SetUp() override { limits.depth = 4; }
 
     void load(const Board& board) {
         tt.clear();
@@ -35,15 +35,13 @@ PrincipalVariation pv_for(Move first, Move second = NULL_MOVE) {
 class RootSearchTest : public ::testing::Test {
 protected:
     RecordingSearchReporter reporter;
-    ThreadPool              pool{1, reporter};
+    TranspositionTable      tt;
+    ThreadPool              pool{1, reporter, tt};
     Thread&                 thread{SearchThreadTestAccess::thread(pool)};
     Worker&                 worker{SearchThreadTestAccess::worker(thread)};
     Limits                  limits;
 
-    void SetUp() override {
-        limits.depth = 4;
-        tt.clear();
-    }
+    void SetUp() override { limits.depth = 4; }
 
     void load(const Board& board, int depth = 4) {
         tt.clear();
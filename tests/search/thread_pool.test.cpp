@@ -58,7 +58,8 @@ private:
 class SearchThreadPoolTest : public ::testing::Test {
 protected:
     RecordingSearchReporter reporter;
-    ThreadPool              pool{THREAD_COUNT, reporter};
+    TranspositionTable      tt;
+    ThreadPool              pool{THREAD_COUNT, reporter, tt};
     Board                   board{board_test::fen::start};
     Limits                  options{default_limits()};
 
@@ -74,10 +75,7 @@ protected:
         return nodes_searched() > 0;
     }
 
-    void SetUp() override {
-        reporter.clear();
-        tt.clear();
-    }
+    void SetUp() override { reporter.clear(); }
 
     int best_move_count() const { return static_cast<int>(reporter.best_moves.size()); }
 };
@@ -85,7 +83,7 @@ protected:
 } // namespace
 
 TEST_F(SearchThreadPoolTest, StartSearchRejectsEmptyPool) {
-    ThreadPool empty_pool{0, reporter};
+    ThreadPool empty_pool{0, reporter, tt};
 
     EXPECT_FALSE(empty_pool.start_search(board, options));
     EXPECT_EQ(tt.current_generation(), std::uint8_t{0});
@@ -101,11 +99,11 @@ TEST_F(SearchThreadPoolTest, StartSearchCompletes) {
 
 TEST(SearchThreadPoolTransitionTest, ImmediateRestartAfterBestMovePublicationIsAccepted) {
     GatedSearchReporter reporter;
-    ThreadPool          pool{2, reporter};
+    TranspositionTable  tt;
+    ThreadPool          pool{2, reporter, tt};
     Board               board{board_test::fen::start};
     Limits              limits;
     limits.depth = 1;
-    tt.clear();
 
     ASSERT_TRUE(pool.start_search(board, limits));
     reporter.wait_for_best_move();
@@ -222,7 +220,7 @@ TEST_F(SearchThreadPoolTest, DestructorShutsDownActiveSearch) {
     options.depth = 5;
 
     {
-        ThreadPool local_pool{THREAD_COUNT, reporter};
+        ThreadPool local_pool{THREAD_COUNT, reporter, tt};
         EXPECT_TRUE(local_pool.start_search(board, options));
     }
 
@@ -4,7 +4,11 @@
 #include <atomic>
 #include <barrier>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -67,12 +71,13 @@ matches_expected_snapshot(const TTRecord&                          record,
     return keys;
 }
 
-void expect_record(PositionKey zkey,
-                   Move        expected_move,
-                   int         expected_score,
-                   int         expected_depth,
-                   TTBound     expected_bound) {
-    auto entry = tt.probe(zkey);
+void expect_record(const TranspositionTable& table,
+                   PositionKey               zkey,
+                   Move                      expected_move,
+                   int                       expected_score,
+                   int                       expected_depth,
+                   TTBound                   expected_bound) {
+    auto entry = table.probe(zkey);
     ASSERT_TRUE(entry.has_value());
     EXPECT_EQ(expected_move, entry->move);
     EXPECT_EQ(expected_score, entry->score);
@@ -89,35 +94,65 @@ protected:
     int         depth = 5;
     TTBound     bound = TTBound::Exact;
 
-    void SetUp() override { tt.clear(); }
+    TranspositionTable tt;
 };
 
 TEST_F(TTTest, StoreAndProbe) {
     tt.store(key, move, score, depth, bound, 0);
 
-    expect_record(key, move, score, depth, bound);
+    expect_record(tt, key, move, score, depth, bound);
 }
 
 TEST_F(TTTest, StoredFieldBoundariesRoundTrip) {
-    for (int i = 0; i < std::numeric_limits<std::uint8_t>::max(); ++i)
+    for (int i = 0; i < tt_generation_cycle - 1; ++i)
         tt.advance_generation();
 
     Move packed_move;
     packed_move.bits = std::numeric_limits<MoveBits>::max();
 
-    constexpr std::int16_t packed_score = -12345;
-    constexpr int          packed_depth = engine::max_search_ply;
-    constexpr TTBound      packed_bound = TTBound::UpperBound;
+    constexpr std::int16_t packed_score       = -12345;
+    constexpr std::int16_t packed_static_eval = -eval_value::inf;
+    constexpr int          packed_depth       = engine::max_search_ply;
+    constexpr TTBound      packed_bound       = TTBound::UpperBound;
 
-    tt.store(key, packed_move, packed_score, packed_depth, packed_bound, 0);
+    tt.store(
+        key, packed_move, packed_score, packed_depth, packed_bound, 0, packed_static_eval, true);
 
     auto entry = tt.probe(key);
     ASSERT_TRUE(entry.has_value());
     EXPECT_EQ(packed_move, entry->move);
     EXPECT_EQ(packed_score, entry->score);
+    EXPECT_EQ(packed_static_eval, entry->static_eval);
     EXPECT_EQ(packed_depth, entry->depth);
-    EXPECT_EQ(std::numeric_limits<std::uint8_t>::max(), entry->generation);
+    EXPECT_EQ(tt_generation_cycle - 1, entry->generation);
     EXPECT_EQ(packed_bound, entry->bound);
+    EXPECT_TRUE(entry->pv);
+}
+
+TEST_F(TTTest, StoreWithoutStaticEvalKeepsCachedEvaluation) {
+    tt.store(key, move, score, depth, bound, 0);
+    ASSERT_TRUE(tt.probe(key).has_value());
+    EXPECT_FALSE(tt.probe(key)->has_static_eval());
+
+    tt.store(key, move, score, depth, bound, 0, 42);
+    tt.store(key, move, score + 1, depth + 1, bound, 0);
+
+    auto entry = tt.probe(key);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_TRUE(entry->has_static_eval());
+    EXPECT_EQ(42, entry->static_eval);
+    EXPECT_EQ(score + 1, entry->score);
+    EXPECT_FALSE(entry->pv);
+}
+
+TEST_F(TTTest, PrefetchLeavesEntriesUnchanged) {
+    tt.store(key, move, score, depth, bound, 0);
+
+    tt.prefetch(key);
+    tt.prefetch(key + 1);
+
+    expect_record(tt, key, move, score, depth, bound);
+    EXPECT_FALSE(tt.probe(key + 1).has_value());
 }
 
 TEST_F(TTTest, ClearRemovesEntries) {
@@ -188,7 +223,7 @@ TEST_F(TTTest, ResizeTable) {
     EXPECT_FALSE(tt.probe(key).has_value());
 
     tt.store(key, move, score, depth, bound, 0);
-    expect_record(key, move, score, depth, bound);
+    expect_record(tt, key, move, score, depth, bound);
 }
 
 TEST_F(TTTest, ResizeZeroKeepsUsableTable) {
@@ -222,6 +257,225 @@ TEST_F(TTTest, ResizeRoundsCapacityDownToLargestFittingPowerOfTwo) {
     }
 }
 
+TEST_F(TTTest, ParallelClearRemovesEntriesAcrossWholeTable) {
+    TranspositionTable table;
+    table.resize(64, 4);
+
+    std::vector<PositionKey> keys;
+    for (PositionKey k = 1; k <= 4096; ++k)
+        keys.push_back(k * 0x9E3779B97F4A7C15ull);
+
+    for (PositionKey k : keys)
+        table.store(k, move, score, depth, bound, 0);
+    table.advance_generation();
+
+    table.clear(4);
+
+    EXPECT_EQ(0, table.current_generation());
+    for (PositionKey k : keys)
+        ASSERT_FALSE(table.probe(k).has_value()) << k;
+}
+
+TEST_F(TTTest, ResizeWithSeveralThreadsKeepsCapacityAndStartsEmpty) {
+    TranspositionTable table;
+    table.store(key, move, score, depth, bound, 0);
+
+    table.resize(16, 8);
+
+    EXPECT_EQ(16U, table.capacity_mb());
+    EXPECT_FALSE(table.probe(key).has_value());
+
+    table.store(key, move, score, depth, bound, 0);
+    EXPECT_TRUE(table.probe(key).has_value());
+}
+
+TEST_F(TTTest, SaveAndLoadRestoreEntriesCapacityAndGeneration) {
+    const auto path =
+        (std::filesystem::temp_directory_path() / "latrunculi_tt_roundtrip.hash").string();
+
+    TranspositionTable saved;
+    saved.resize(2);
+    saved.advance_generation();
+    saved.store(key, move, score, depth, bound, 0, 37, true);
+    saved.save(path);
+
+    TranspositionTable loaded;
+    loaded.store(key + 1, move, score, depth, bound, 0);
+    loaded.load(path);
+
+    EXPECT_EQ(2U, loaded.capacity_mb());
+    EXPECT_EQ(1, loaded.current_generation());
+    EXPECT_EQ(TTMemory::PageKind::File, loaded.page_kind());
+    EXPECT_FALSE(loaded.probe(key + 1).has_value());
+
+    auto entry = loaded.probe(key);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(move, entry->move);
+    EXPECT_EQ(score, entry->score);
+    EXPECT_EQ(37, entry->static_eval);
+    EXPECT_TRUE(entry->pv);
+
+    // Updates land in private pages, and saving over the mapped file keeps them consistent.
+    loaded.store(key, move, score + 1, depth + 1, bound, 0);
+    loaded.save(path);
+    loaded.clear();
+
+    TranspositionTable reloaded;
+    reloaded.load(path);
+    ASSERT_TRUE(reloaded.probe(key).has_value());
+    EXPECT_EQ(score + 1, reloaded.probe(key)->score);
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(TTTest, EvaluatorChangeClearsTableAndGuardsHashFiles) {
+    const auto path =
+        (std::filesystem::temp_directory_path() / "latrunculi_tt_evaluator.hash").string();
+
+    TranspositionTable table(1);
+    EXPECT_EQ(tt_handcrafted_evaluator, table.evaluator());
+    table.store(key, move, score, depth, bound, 0, 37);
+    table.save(path);
+
+    table.set_evaluator(tt_handcrafted_evaluator);
+    EXPECT_TRUE(table.probe(key).has_value());
+
+    // Static evaluations from another evaluator would steer pruning, so none survive.
+    table.set_evaluator(0x1234);
+    EXPECT_EQ(0x1234U, table.evaluator());
+    EXPECT_FALSE(table.probe(key).has_value());
+    EXPECT_THROW(table.load(path), std::runtime_error);
+
+    table.set_evaluator(tt_handcrafted_evaluator);
+    table.load(path);
+    EXPECT_TRUE(table.probe(key).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(TTTest, SharedSegmentRecordsItsEvaluator) {
+    const std::string name = "latrunculi_tt_shared_evaluator_test";
+    TTMemory::remove_shared(name);
+
+    TranspositionTable first;
+    first.attach_shared(name, 2);
+    first.store(key, move, score, depth, bound, 0, 37);
+    EXPECT_THROW(first.set_evaluator(0x1234), std::runtime_error);
+    EXPECT_EQ(tt_handcrafted_evaluator, first.evaluator());
+
+    TranspositionTable other;
+    other.set_evaluator(0x1234);
+    EXPECT_THROW(other.attach_shared(name, 2), std::runtime_error);
+    EXPECT_NE(TTMemory::PageKind::Shared, other.page_kind());
+    EXPECT_TRUE(first.probe(key).has_value());
+
+    TTMemory::remove_shared(name);
+}
+
+TEST_F(TTTest, LoadRejectsMissingAndMalformedFilesAndKeepsTable) {
+    const auto path = (std::filesystem::temp_directory_path() / "latrunculi_tt_bad.hash").string();
+    std::filesystem::remove(path);
+
+    TranspositionTable table;
+    table.store(key, move, score, depth, bound, 0);
+
+    EXPECT_THROW(table.load(path), std::runtime_error);
+
+    std::ofstream(path, std::ios::binary) << "not a transposition table";
+    EXPECT_THROW(table.load(path), std::runtime_error);
+
+    table.save(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 64);
+    EXPECT_THROW(table.load(path), std::runtime_error);
+
+    EXPECT_TRUE(table.probe(key).has_value());
+    std::filesystem::remove(path);
+}
+
+TEST_F(TTTest, TablesAttachedToOneSharedSegmentSeeEachOthersEntries) {
+    const std::string name = "latrunculi_tt_shared_test";
+    TTMemory::remove_shared(name);
+
+    TranspositionTable first;
+    TranspositionTable second;
+    first.attach_shared(name, 2);
+    second.attach_shared(name, 2);
+
+    EXPECT_EQ(2U, second.capacity_mb());
+    EXPECT_EQ(TTMemory::PageKind::Shared, second.page_kind());
+    EXPECT_FALSE(second.probe(key).has_value());
+
+    first.store(key, move, score, depth, bound, 0);
+    expect_record(second, key, move, score, depth, bound);
+
+    second.clear();
+    EXPECT_FALSE(first.probe(key).has_value());
+
+    EXPECT_THROW(second.attach_shared(name, 4), std::runtime_error);
+    EXPECT_EQ(2U, second.capacity_mb());
+
+    TTMemory::remove_shared(name);
+}
+
+TEST_F(TTTest, SoleUserResizesItsSharedSegmentInPlace) {
+    const std::string name = "latrunculi_tt_shared_resize_test";
+    TTMemory::remove_shared(name);
+
+    TranspositionTable table;
+    table.attach_shared(name, 2);
+    table.advance_generation();
+    table.store(key, move, score, depth, bound, 0);
+
+    table.attach_shared(name, 2);
+    EXPECT_TRUE(table.probe(key).has_value());
+
+    table.attach_shared(name, 4);
+    EXPECT_EQ(4U, table.capacity_mb());
+    EXPECT_EQ(TTMemory::PageKind::Shared, table.page_kind());
+    EXPECT_FALSE(table.probe(key).has_value());
+    EXPECT_EQ(1U, table.current_generation());
+
+    // The resized segment is the one later processes attach to.
+    TranspositionTable other;
+    other.attach_shared(name, 4);
+    table.store(key, move, score, depth, bound, 0);
+    expect_record(other, key, move, score, depth, bound);
+    EXPECT_THROW(table.attach_shared(name, 2), std::runtime_error);
+    EXPECT_EQ(4U, table.capacity_mb());
+
+    TTMemory::remove_shared(name);
+}
+
+TEST_F(TTTest, TablesAttachedToOneSharedSegmentAgeEntriesOnOneGeneration) {
+    const std::string name = "latrunculi_tt_shared_generation_test";
+    TTMemory::remove_shared(name);
+
+    TranspositionTable first;
+    TranspositionTable second;
+    first.attach_shared(name, 2);
+    second.attach_shared(name, 2);
+
+    first.advance_generation();
+    first.advance_generation();
+    second.advance_generation();
+    EXPECT_EQ(3U, second.current_generation());
+
+    first.store(key, move, score, depth, bound, 0);
+    ASSERT_TRUE(second.probe(key).has_value());
+    EXPECT_EQ(2U, second.probe(key)->generation);
+
+    // Clearing empties the shared clusters but keeps the clock other processes stamp with.
+    first.clear();
+    EXPECT_FALSE(second.probe(key).has_value());
+    EXPECT_EQ(2U, first.current_generation());
+
+    TranspositionTable late;
+    late.attach_shared(name, 2);
+    EXPECT_EQ(3U, late.current_generation());
+
+    TTMemory::remove_shared(name);
+}
+
 TEST_F(TTTest, ProbeRejectsDifferentFullKeyInSameCluster) {
     tt.resize(1);
 
@@ -242,11 +496,11 @@ TEST_F(TTTest, ReplacementScoreUsesDepthMinusWrappedAgeDistance) {
         .move       = move,
         .score      = std::int16_t(score),
         .depth      = std::uint8_t(depth),
-        .generation = std::uint8_t{255},
+        .generation = std::uint8_t{tt_generation_cycle - 1},
         .bound      = bound,
     };
 
-    EXPECT_EQ(record.replacement_score(255), depth);
+    EXPECT_EQ(record.replacement_score(tt_generation_cycle - 1), depth);
     EXPECT_EQ(record.replacement_score(0), depth - 4);
 
     TTRecord deeper_record = record;
@@ -259,7 +513,7 @@ TEST_F(TTTest, SameKeyNullMoveStorePreservesPreviousMoveAndUpdatesAcceptedFields
 
     tt.store(key, NULL_MOVE, 250, 7, TTBound::LowerBound, 0);
 
-    expect_record(key, move, 250, 7, TTBound::LowerBound);
+    expect_record(tt, key, move, 250, 7, TTBound::LowerBound);
 }
 
 TEST_F(TTTest, SameKeyReplacementUsesDepthAndBoundQuality) {
@@ -286,53 +540,52 @@ TEST_F(TTTest, SameKeyReplacementUsesDepthAndBoundQuality) {
         tt.store(key, new_move, 250, tc.new_depth, tc.new_bound, 0);
 
         if (tc.replaces)
-            expect_record(key, new_move, 250, tc.new_depth, tc.new_bound);
+            expect_record(tt, key, new_move, 250, tc.new_depth, tc.new_bound);
         else
-            expect_record(key, move, 100, tc.old_depth, tc.old_bound);
+            expect_record(tt, key, move, 100, tc.old_depth, tc.old_bound);
     }
 }
 
 TEST_F(TTTest, DifferentKeyNullMoveReplacementKeepsNullMove) {
     tt.resize(1);
 
-    const auto keys = find_keys_in_same_one_mb_cluster(key, 5);
-    ASSERT_EQ(5U, keys.size());
+    const auto keys = find_keys_in_same_one_mb_cluster(key, TTCluster::size + 1);
+    ASSERT_EQ(size_t(TTCluster::size + 1), keys.size());
 
-    const std::array<Move, 4> moves = {Move(A2, A3), Move(B2, B3), Move(C2, C3), Move(D2, D3)};
+    const std::array<Move, TTCluster::size> moves = {
+        Move(A2, A3), Move(B2, B3), Move(C2, C3), Move(D2, D3), Move(E2, E3)};
 
     for (size_t i = 0; i < moves.size(); ++i) {
         tt.store(keys[i], moves[i], score + int(i), int(i + 1), TTBound::Exact, 0);
         ASSERT_TRUE(tt.probe(keys[i]).has_value());
     }
 
-    tt.store(keys[4], NULL_MOVE, 500, 8, TTBound::LowerBound, 0);
+    tt.store(keys[TTCluster::size], NULL_MOVE, 500, 8, TTBound::LowerBound, 0);
 
-    expect_record(keys[4], NULL_MOVE, 500, 8, TTBound::LowerBound);
+    expect_record(tt, keys[TTCluster::size], NULL_MOVE, 500, 8, TTBound::LowerBound);
 }
 
 TEST_F(TTTest, FullClusterReplacementChoosesLowestReplacementScore) {
     tt.resize(1);
 
-    const auto keys = find_keys_in_same_one_mb_cluster(key, 5);
-    ASSERT_EQ(5U, keys.size());
+    const auto keys = find_keys_in_same_one_mb_cluster(key, TTCluster::size + 1);
+    ASSERT_EQ(size_t(TTCluster::size + 1), keys.size());
 
-    const std::array<int, 4>  depths = {9, 1, 5, 7};
-    const std::array<Move, 5> moves  = {
-        Move(A2, A3), Move(B2, B3), Move(C2, C3), Move(D2, D3), Move(E2, E3)};
+    const std::array<int, TTCluster::size>      depths = {9, 1, 5, 7, 6};
+    const std::array<Move, TTCluster::size + 1> moves  = {
+        Move(A2, A3), Move(B2, B3), Move(C2, C3), Move(D2, D3), Move(E2, E3), Move(F2, F3)};
 
     for (size_t i = 0; i < depths.size(); ++i) {
         tt.store(keys[i], moves[i], score + int(i), depths[i], TTBound::Exact, 0);
         ASSERT_TRUE(tt.probe(keys[i]).has_value());
     }
 
-    tt.store(keys[4], moves[4], 500, 8, TTBound::LowerBound, 0);
+    tt.store(keys[TTCluster::size], moves[TTCluster::size], 500, 8, TTBound::LowerBound, 0);
 
-    EXPECT_TRUE(tt.probe(keys[0]).has_value());
-    EXPECT_FALSE(tt.probe(keys[1]).has_value());
-    EXPECT_TRUE(tt.probe(keys[2]).has_value());
-    EXPECT_TRUE(tt.probe(keys[3]).has_value());
+    for (size_t i = 0; i < depths.size(); ++i)
+        EXPECT_EQ(i != 1, tt.probe(keys[i]).has_value()) << i;
 
-    expect_record(keys[4], moves[4], 500, 8, TTBound::LowerBound);
+    expect_record(tt, keys[TTCluster::size], moves[TTCluster::size], 500, 8, TTBound::LowerBound);
 }
 
 TEST_F(TTTest, ProbeReturnsDetachedSnapshot) {
@@ -0,0 +1,164 @@
+#include "search/tt_memory.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+
+namespace search {
+
+TEST(TTMemoryTest, DefaultMemoryIsEmpty) {
+    TTMemory memory;
+
+    EXPECT_EQ(nullptr, memory.data());
+    EXPECT_EQ(0U, memory.size());
+    EXPECT_EQ(TTMemory::PageKind::None, memory.page_kind());
+}
+
+TEST(TTMemoryTest, AllocationIsZeroFilledAndCacheLineAligned) {
+    constexpr std::size_t bytes = std::size_t{1} << 16;
+
+    auto memory = TTMemory::allocate(bytes);
+
+    ASSERT_NE(nullptr, memory.data());
+    EXPECT_EQ(bytes, memory.size());
+    EXPECT_NE(TTMemory::PageKind::None, memory.page_kind());
+    EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(memory.data()) % 64);
+
+    const auto* begin = static_cast<const unsigned char*>(memory.data());
+    for (std::size_t i = 0; i < bytes; ++i)
+        ASSERT_EQ(0, begin[i]) << i;
+}
+
+TEST(TTMemoryTest, HugePageSizedAllocationStartsOnHugePageBoundary) {
+    constexpr std::size_t huge_page_bytes = std::size_t{2} << 20;
+
+    auto memory = TTMemory::allocate(2 * huge_page_bytes);
+
+    ASSERT_NE(nullptr, memory.data());
+    EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(memory.data()) % huge_page_bytes);
+}
+
+TEST(TTMemoryTest, FileMappingStartsAtOffsetAndKeepsWritesPrivate) {
+    const auto path =
+        (std::filesystem::temp_directory_path() / "latrunculi_tt_memory.bin").string();
+    std::ofstream(path, std::ios::binary) << "headerpayload";
+
+    {
+        auto memory = TTMemory::map_file(path, 6, 7);
+
+        ASSERT_NE(nullptr, memory.data());
+        EXPECT_EQ(7U, memory.size());
+        EXPECT_EQ(TTMemory::PageKind::File, memory.page_kind());
+        EXPECT_EQ(0, std::memcmp(memory.data(), "payload", 7));
+
+        static_cast<char*>(memory.data())[0] = 'P';
+    }
+
+    std::string contents;
+    std::ifstream(path, std::ios::binary) >> contents;
+    EXPECT_EQ("headerpayload", contents);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW((void)TTMemory::map_file(path, 0, 7), std::runtime_error);
+}
+
+TEST(TTMemoryTest, SharedSegmentIsVisibleAcrossMappingsAndKeepsItsSize) {
+    const std::string name = "latrunculi_tt_memory_test";
+    TTMemory::remove_shared(name);
+
+    auto holder = TTMemory::open_shared(name, 4096);
+    {
+        auto first  = TTMemory::open_shared(name, 4096);
+        auto second = TTMemory::open_shared("/" + name, 4096);
+
+        ASSERT_NE(nullptr, first.data());
+        EXPECT_EQ(TTMemory::PageKind::Shared, first.page_kind());
+        EXPECT_EQ(0, static_cast<const unsigned char*>(first.data())[4095]);
+
+        static_cast<unsigned char*>(first.data())[17] = 0x5A;
+        EXPECT_EQ(0x5A, static_cast<const unsigned char*>(second.data())[17]);
+
+        EXPECT_THROW((void)TTMemory::open_shared(name, 8192), std::runtime_error);
+    }
+
+    auto reopened = TTMemory::open_shared(name, 4096);
+    EXPECT_EQ(0x5A, static_cast<const unsigned char*>(reopened.data())[17]);
+}
+
+TEST(TTMemoryTest, LastSharedMappingUnlinksTheSegment) {
+    const std::string name = "latrunculi_tt_memory_unlink_test";
+    TTMemory::remove_shared(name);
+
+    {
+        auto first  = TTMemory::open_shared(name, 4096);
+        auto second = TTMemory::open_shared(name, 4096);
+        static_cast<unsigned char*>(first.data())[17] = 0x5A;
+        first                                          = TTMemory{};
+        EXPECT_EQ(0x5A, static_cast<const unsigned char*>(second.data())[17]);
+    }
+
+    auto reopened = TTMemory::open_shared(name, 4096);
+    EXPECT_EQ(0, static_cast<const unsigned char*>(reopened.data())[17]);
+}
+
+TEST(TTMemoryTest, SharedHeaderIsCommonToEveryMapping) {
+    const std::string name = "latrunculi_tt_memory_header_test";
+    TTMemory::remove_shared(name);
+
+    auto first  = TTMemory::open_shared(name, 4096);
+    auto second = TTMemory::open_shared(name, 4096);
+    ASSERT_NE(nullptr, first.shared_header());
+    EXPECT_EQ(nullptr, TTMemory::allocate(4096).shared_header());
+    EXPECT_EQ(2U, first.shared_header()->users.load());
+    EXPECT_EQ(0U, first.shared_header()->evaluator.load());
+
+    first.shared_header()->generation.store(7);
+    EXPECT_EQ(7U, second.shared_header()->generation.load());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(TTMemoryTest, SharedSegmentNotYetSizedByItsCreatorIsSizedOnOpen) {
+    const std::string name = "latrunculi_tt_memory_unsized_test";
+    TTMemory::remove_shared(name);
+
+    // A creator between shm_open and ftruncate leaves a zero-byte segment.
+    const int fd = shm_open(("/" + name).c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    auto memory = TTMemory::open_shared(name, 4096);
+    EXPECT_EQ(0, static_cast<const unsigned char*>(memory.data())[4095]);
+    EXPECT_NO_THROW((void)TTMemory::open_shared(name, 4096));
+    EXPECT_THROW((void)TTMemory::open_shared(name, 8192), std::runtime_error);
+}
+#endif
+
+TEST(TTMemoryTest, MoveTransfersOwnership) {
+    auto  source = TTMemory::allocate(4096);
+    void* data   = source.data();
+
+    TTMemory target = std::move(source);
+
+    EXPECT_EQ(data, target.data());
+    EXPECT_EQ(4096U, target.size());
+    EXPECT_EQ(nullptr, source.data());
+    EXPECT_EQ(TTMemory::PageKind::None, source.page_kind());
+
+    target = TTMemory{};
+    EXPECT_EQ(nullptr, target.data());
+}
+
+} // namespace search
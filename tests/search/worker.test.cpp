@@ -7,6 +7,7 @@
 #include "board/board.hpp"
 #include "search/limits.hpp"
 #include "search/thread_pool.hpp"
+#include "search/tt.hpp"
 #include "support/board_fixtures.hpp"
 #include "support/search_reporter.hpp"
 #include "support/search_test_access.hpp"
@@ -19,7 +20,8 @@ namespace {
 class SearchWorkerTest : public ::testing::Test {
 protected:
     RecordingSearchReporter reporter;
-    ThreadPool              pool{1, reporter};
+    TranspositionTable      tt;
+    ThreadPool              pool{1, reporter, tt};
 
     Thread& test_thread() { return SearchThreadTestAccess::thread(pool); }
 
@@ -91,7 +93,7 @@ TEST_F(SearchWorkerTest, HelperDepthsFollowStaggeringSchedule) {
         {true, false, false, true, true, false, false, true},
     }};
 
-    ThreadPool helper_pool{expected.size(), reporter};
+    ThreadPool helper_pool{expected.size(), reporter, tt};
     for (size_t worker_id = 0; worker_id < expected.size(); ++worker_id) {
         const Worker& search_worker = SearchThreadTestAccess::worker(helper_pool, worker_id);
         for (int depth = 1; depth <= static_cast<int>(expected[worker_id].size()); ++depth) {
@@ -18,11 +18,12 @@ protected:
     void SetUp() override {
         output.str("");
         output.clear();
-        search::tt.clear();
     }
 
-    bool                execute(const std::string& command) { return engine.execute(command); }
-    Board&              board() { return engine.board; }
-    search::ThreadPool& thread_pool() { return engine.thread_pool; }
-    const uci::Options& options() const { return engine.options; }
+    bool execute(const std::string& command) { return engine.execute(command); }
+    Board&                      board() { return engine.board; }
+    search::ThreadPool&         thread_pool() { return engine.thread_pool; }
+    search::TranspositionTable& tt() { return engine.tt; }
+    const uci::Options&         options() const { return engine.options; }
+    const eval::nnue::Network*  network() const { return engine.network.get(); }
 };
@@ -31,20 +31,21 @@ public:
     template <Color C>
     static eval::TaperedScore shelter(const Board& board, Square king_sq) {
         const eval::Evaluator evaluator(board);
-        return evaluator.evaluate_shelter<C>(king_sq);
+        return evaluator.evaluate_shelter<false, C>(king_sq);
     }
 
     template <Color C>
     static eval::TaperedScore
     shelter_file(const Board& board, Bitboard pawns, Bitboard opponent_pawns, File file) {
         const eval::Evaluator evaluator(board);
-        return evaluator.evaluate_shelter_file<C>(pawns, opponent_pawns, file);
+        return evaluator.evaluate_shelter_file<false, C>(pawns, opponent_pawns, file);
     }
 
     template <Color C>
     static int raw_danger(const Board& board, Square king_sq) {
+        // Tracing accumulates attack data even where a known endgame short-circuits evaluate().
         eval::Evaluator evaluator(board);
-        (void)evaluator.evaluate();
+        (void)evaluator.trace();
         return evaluator.calculate_raw_danger<C>(king_sq);
     }
 
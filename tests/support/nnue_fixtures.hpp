@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "eval/nnue/network.hpp"
+
+namespace nnue_test {
+
+// Deterministic network with small random parameters; accumulators stay far from int16
+// overflow while activations still span the clipped range.
+inline std::unique_ptr<eval::nnue::Network> random_network(std::uint32_t seed = 1) {
+    std::mt19937                       engine(seed);
+    std::uniform_int_distribution<int> small(-48, 48);
+
+    auto network = std::make_unique<eval::nnue::Network>();
+    for (auto& value : network->feature_biases)
+        value = std::int16_t(small(engine) + 32);
+    for (auto& value : network->feature_weights)
+        value = std::int16_t(small(engine));
+    for (auto& value : network->hidden_biases)
+        value = small(engine) * 64;
+    for (auto& value : network->hidden_weights)
+        value = std::int8_t(small(engine));
+    network->output_bias = small(engine) * 16;
+    for (auto& value : network->output_weights)
+        value = std::int8_t(small(engine));
+    return network;
+}
+
+} // namespace nnue_test
@@ -0,0 +1,124 @@
+#include "tune/dataset.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "board/board.hpp"
+#include "support/board_fixtures.hpp"
+
+namespace {
+
+std::filesystem::path write_dataset(const std::string& name, const std::string& contents) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path) << contents;
+    return path;
+}
+
+} // namespace
+
+TEST(DatasetTest, ParsesFenAndEpdRecords) {
+    const auto fen = tune::parse_labelled_position(
+        "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 3 17 [1-0]");
+    ASSERT_TRUE(fen);
+    EXPECT_EQ(fen->fen, "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 3 17");
+    EXPECT_EQ(fen->result, 1.0);
+
+    const auto epd = tune::parse_labelled_position(
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - c9 \"1/2-1/2\";");
+    ASSERT_TRUE(epd);
+    EXPECT_EQ(epd->fen, board_test::fen::start);
+    EXPECT_EQ(epd->result, 0.5);
+
+    const auto numeric = tune::parse_labelled_position("4k3/8/8/8/8/8/8/4K3 b - - 0.25");
+    ASSERT_TRUE(numeric);
+    EXPECT_EQ(numeric->fen, "4k3/8/8/8/8/8/8/4K3 b - - 0 1");
+    EXPECT_EQ(numeric->result, 0.25);
+
+    EXPECT_EQ(tune::parse_labelled_position("4k3/8/8/8/8/8/8/4K3 w - - 0 1 0-1")->result, 0.0);
+}
+
+TEST(DatasetTest, SkipsBlankAndCommentLines) {
+    EXPECT_FALSE(tune::parse_labelled_position(""));
+    EXPECT_FALSE(tune::parse_labelled_position("   \r"));
+    EXPECT_FALSE(tune::parse_labelled_position("# fen result"));
+}
+
+TEST(DatasetTest, RejectsUnreadableLines) {
+    EXPECT_THROW((void)tune::parse_labelled_position("4k3/8/8/8/8/8/8/4K3 w - 1-0"),
+                 std::invalid_argument);
+    EXPECT_THROW((void)tune::parse_labelled_position("4k3/8/8/8/8/8/8/4K3 w - - win"),
+                 std::invalid_argument);
+    EXPECT_THROW((void)tune::parse_labelled_position("4k3/8/8/8/8/8/8/4K3 w - - 1.5"),
+                 std::invalid_argument);
+}
+
+TEST(DatasetTest, AppendRebasesCoefficientRuns) {
+    const auto first  = eval::extract_features(Board(board_test::fen::perft_position_2));
+    const auto second = eval::extract_features(Board(board_test::fen::perft_position_5));
+    ASSERT_TRUE(first && second);
+
+    tune::Dataset left;
+    tune::Dataset right;
+    left.add(*first, 1.0);
+    right.add(*second, 0.0);
+    left.append(right);
+
+    ASSERT_EQ(left.size(), 2u);
+    const auto coefficients = left.coefficients(left.samples()[1]);
+    ASSERT_EQ(coefficients.size(), second->coefficients.size());
+    for (std::size_t index = 0; index < coefficients.size(); ++index) {
+        EXPECT_EQ(coefficients[index].parameter, second->coefficients[index].parameter);
+        EXPECT_EQ(coefficients[index].value, second->coefficients[index].value);
+    }
+    EXPECT_EQ(left.samples()[1].result, 0.0);
+    EXPECT_EQ(left.samples()[1].phase, second->phase);
+}
+
+TEST(DatasetTest, LoadingKeepsFileOrderForAnyThreadCount) {
+    const auto path = write_dataset("latrunculi_dataset_order.txt",
+                                    std::string(board_test::fen::perft_position_2) + " 1-0\n"
+                                        "# comment\n"
+                                        "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1 1-0\n"
+                                        + std::string(board_test::fen::perft_position_5)
+                                        + " 0-1\n" + std::string(board_test::fen::start)
+                                        + " 1/2-1/2\n");
+
+    const tune::Dataset serial = tune::load_dataset(path.string(), 1);
+    ASSERT_EQ(serial.size(), 3u); // KPK has no linear features.
+    EXPECT_EQ(serial.samples()[0].result, 1.0);
+    EXPECT_EQ(serial.samples()[1].result, 0.0);
+    EXPECT_EQ(serial.samples()[2].result, 0.5);
+
+    for (int threads : {2, 3, 8}) {
+        SCOPED_TRACE(threads);
+        const tune::Dataset parallel = tune::load_dataset(path.string(), threads);
+        ASSERT_EQ(parallel.size(), serial.size());
+        for (std::size_t index = 0; index < serial.size(); ++index) {
+            const tune::Sample& expected = serial.samples()[index];
+            const tune::Sample& actual   = parallel.samples()[index];
+            EXPECT_EQ(actual.result, expected.result);
+            EXPECT_EQ(actual.end - actual.begin, expected.end - expected.begin);
+            EXPECT_EQ(actual.fixed, expected.fixed);
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(DatasetTest, LoadingNamesTheFirstBadLine) {
+    const auto path = write_dataset("latrunculi_dataset_bad.txt",
+                                    std::string(board_test::fen::start) + " 1-0\n"
+                                        + std::string(board_test::fen::start) + " draw\n");
+    try {
+        (void)tune::load_dataset(path.string(), 2);
+        ADD_FAILURE() << "expected std::runtime_error";
+    } catch (const std::runtime_error& error) {
+        EXPECT_NE(std::string(error.what()).find("line 2"), std::string::npos) << error.what();
+    }
+    std::filesystem::remove(path);
+
+    EXPECT_THROW((void)tune::load_dataset("/nonexistent/dataset.txt", 1), std::runtime_error);
+}
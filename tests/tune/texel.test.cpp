@@ -0,0 +1,89 @@
+#include "tune/texel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string_view>
+
+#include "board/board.hpp"
+#include "eval/evaluation.hpp"
+#include "support/board_fixtures.hpp"
+
+namespace {
+
+constexpr std::string_view fixture_fens[] = {
+    board_test::fen::start,
+    board_test::fen::perft_position_2,
+    board_test::fen::perft_position_4_black,
+    board_test::fen::perft_position_5,
+    board_test::fen::perft_position_6,
+    board_test::fen::castling,
+};
+
+// Labels each fixture with its expected score under the current weights at scaling k.
+tune::Dataset fixture_dataset(double k) {
+    const tune::Weights weights = tune::to_weights(eval::current_parameters());
+
+    tune::Dataset dataset;
+    for (const std::string_view fen : fixture_fens) {
+        const auto features = eval::extract_features(Board(fen));
+        if (!features)
+            continue;
+
+        tune::Dataset single;
+        single.add(*features, 0.0);
+        const double value = tune::predict(single, single.samples()[0], weights);
+        dataset.add(*features, 1.0 / (1.0 + std::exp(-k * value / 400.0)));
+    }
+    return dataset;
+}
+
+} // namespace
+
+TEST(TexelTest, WeightsRoundTripThroughParameters) {
+    const eval::ParameterVector parameters = eval::current_parameters();
+    const tune::Weights         weights    = tune::to_weights(parameters);
+    ASSERT_EQ(weights.size(), 2 * parameters.size());
+    EXPECT_EQ(weights[2 * eval::parameter::iso_pawn], eval::iso_pawn.mg());
+    EXPECT_EQ(weights[2 * eval::parameter::iso_pawn + 1], eval::iso_pawn.eg());
+    EXPECT_EQ(tune::to_parameters(weights), parameters);
+}
+
+TEST(TexelTest, PredictionTracksTheEvaluator) {
+    const tune::Dataset dataset = fixture_dataset(1.0);
+    const tune::Weights weights = tune::to_weights(eval::current_parameters());
+    const Board         board(board_test::fen::perft_position_2);
+
+    const double white_eval = board.side_to_move() == WHITE ? eval::evaluate(board)
+                                                            : -eval::evaluate(board);
+    EXPECT_NEAR(tune::predict(dataset, dataset.samples()[1], weights), white_eval, 2.0);
+}
+
+TEST(TexelTest, ScalingFitRecoversTheLabellingScale) {
+    const tune::Dataset dataset = fixture_dataset(1.3);
+    const tune::Weights weights = tune::to_weights(eval::current_parameters());
+
+    const double k = tune::fit_scaling(dataset, weights, 1);
+    EXPECT_NEAR(k, 1.3, 1e-4);
+    EXPECT_NEAR(tune::loss(dataset, weights, k, 1), 0.0, 1e-9);
+    EXPECT_EQ(tune::fit_scaling(dataset, weights, 3), k);
+}
+
+TEST(TexelTest, OptimiserLowersLossReproducibly) {
+    // Labelled at a sharper scale than the optimiser uses, so the weights must grow to fit.
+    const tune::Dataset dataset = fixture_dataset(2.0);
+    const tune::Weights initial = tune::to_weights(eval::current_parameters());
+    const double        k       = 1.0;
+
+    tune::TunerOptions options;
+    options.epochs  = 20;
+    options.threads = 2;
+
+    int  epochs_seen = 0;
+    auto tuned       = tune::optimise(dataset, initial, k, options, [&](int epoch, const auto&) {
+        EXPECT_EQ(epoch, ++epochs_seen);
+    });
+    EXPECT_EQ(epochs_seen, options.epochs);
+    EXPECT_LT(tune::loss(dataset, tuned, k, 2), tune::loss(dataset, initial, k, 2));
+    EXPECT_EQ(tune::optimise(dataset, initial, k, options), tuned);
+}
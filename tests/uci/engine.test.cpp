@@ -85,4 +85,6 @@ INSTANTIATE_TEST_SUITE_P(
         CommandCase{{"position startpos", "move e2e4", "move undo"}, board_test::fen::start, ""},
         CommandCase{{"position startpos", "moves"}, board_test::fen::start, "e2e4"},
         CommandCase{{"position startpos", "perft 1"}, board_test::fen::start, "NODES: 20"},
+        CommandCase{{"position startpos", "perft 3 1"}, board_test::fen::start, "NODES: 8902"},
+        CommandCase{{"position startpos", "perft 2 0"}, board_test::fen::start, "NODES: 400"},
         CommandCase{{"position startpos", "perft 0"}, board_test::fen::start, "NODES: 1"}));
@@ -1,9 +1,11 @@
 #include "support/engine_test_fixture.hpp"
 
+#include <filesystem>
 #include <string>
 
 #include "core/move.hpp"
 #include "search/tt.hpp"
+#include "support/nnue_fixtures.hpp"
 #include "gtest/gtest.h"
 
 class EngineOptionsTest : public EngineTest {
@@ -39,14 +41,148 @@ TEST_F(EngineOptionsTest, PonderOptionValuesAreCaseInsensitive) {
 TEST_F(EngineOptionsTest, HashOptionResizesAndClearHashClearsTT) {
     ASSERT_TRUE(execute("setoption name Hash value 8"));
     ASSERT_EQ(hash_option_mb(), 8);
-    ASSERT_EQ(search::tt.capacity_mb(), 8U);
+    ASSERT_EQ(tt().capacity_mb(), 8U);
 
-    search::tt.store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0);
-    ASSERT_TRUE(search::tt.probe(board().key()).has_value());
+    tt().store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0);
+    ASSERT_TRUE(tt().probe(board().key()).has_value());
 
     EXPECT_TRUE(execute("setoption name Clear Hash"));
 
-    EXPECT_FALSE(search::tt.probe(board().key()).has_value());
+    EXPECT_FALSE(tt().probe(board().key()).has_value());
+}
+
+TEST_F(EngineOptionsTest, SaveAndLoadHashRestoreTTAndReportLoadedSize) {
+    const auto path = (std::filesystem::temp_directory_path() / "latrunculi_engine.hash").string();
+
+    ASSERT_TRUE(execute("setoption name Hash value 4"));
+    tt().store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0);
+
+    EXPECT_TRUE(execute("setoption name Save Hash"));
+    EXPECT_NE(output.str().find("error: missing hash file path"), std::string::npos);
+
+    ASSERT_TRUE(execute("setoption name HashFile value " + path));
+    ASSERT_TRUE(execute("setoption name Save Hash"));
+    ASSERT_TRUE(execute("setoption name Hash value 8"));
+    ASSERT_FALSE(tt().probe(board().key()).has_value());
+
+    EXPECT_TRUE(execute("setoption name Load Hash"));
+    EXPECT_EQ(hash_option_mb(), 4);
+    EXPECT_EQ(tt().capacity_mb(), 4U);
+    EXPECT_TRUE(tt().probe(board().key()).has_value());
+
+    EXPECT_TRUE(execute("ucinewgame"));
+    EXPECT_TRUE(execute("loadhash " + path));
+    EXPECT_TRUE(tt().probe(board().key()).has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(EngineOptionsTest, SharedHashAttachesSegmentAndFollowsHashSize) {
+    const std::string name = "latrunculi_engine_shared_test";
+    search::TTMemory::remove_shared(name);
+
+    search::TranspositionTable peer;
+    peer.attach_shared(name, 2);
+    peer.store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0);
+
+    ASSERT_TRUE(execute("setoption name Hash value 2"));
+    ASSERT_TRUE(execute("setoption name SharedHash value " + name));
+    EXPECT_EQ(tt().page_kind(), search::TTMemory::PageKind::Shared);
+    EXPECT_TRUE(tt().probe(board().key()).has_value());
+
+    EXPECT_TRUE(execute("setoption name Hash value 4"));
+    EXPECT_NE(output.str().find("error: cannot resize a shared hash other processes use"),
+              std::string::npos);
+    EXPECT_EQ(hash_option_mb(), 2);
+    EXPECT_TRUE(tt().probe(board().key()).has_value());
+
+    // Once the peer detaches this engine is the only user and resizes the segment in place.
+    peer.resize(1);
+    ASSERT_TRUE(execute("setoption name Hash value 4"));
+    EXPECT_EQ(hash_option_mb(), 4);
+    EXPECT_EQ(tt().capacity_mb(), 4U);
+    EXPECT_EQ(tt().page_kind(), search::TTMemory::PageKind::Shared);
+
+    EXPECT_TRUE(execute("setoption name SharedHash"));
+    EXPECT_NE(tt().page_kind(), search::TTMemory::PageKind::Shared);
+    EXPECT_FALSE(tt().probe(board().key()).has_value());
+
+    search::TTMemory::remove_shared(name);
+}
+
+TEST_F(EngineOptionsTest, NewGameAgesSharedHashInsteadOfWipingIt) {
+    const std::string name = "latrunculi_engine_shared_newgame_test";
+    search::TTMemory::remove_shared(name);
+
+    search::TranspositionTable peer;
+    peer.attach_shared(name, 2);
+
+    ASSERT_TRUE(execute("setoption name Hash value 2"));
+    ASSERT_TRUE(execute("setoption name SharedHash value " + name));
+    peer.store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0);
+
+    EXPECT_TRUE(execute("ucinewgame"));
+    EXPECT_TRUE(peer.probe(board().key()).has_value());
+    EXPECT_EQ(tt().current_generation(), 1U);
+
+    peer.advance_generation();
+    EXPECT_EQ(peer.current_generation(), 2U);
+
+    EXPECT_TRUE(execute("setoption name Clear Hash"));
+    EXPECT_FALSE(peer.probe(board().key()).has_value());
+    EXPECT_NE(output.str().find("shared hash cleared for every attached process"),
+              std::string::npos);
+
+    search::TTMemory::remove_shared(name);
+}
+
+TEST_F(EngineOptionsTest, EvalFileLoadsNetworkAndEmptyRestoresHandcraftedEvaluation) {
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "latrunculi_engine_network.nnue").string();
+    nnue_test::random_network()->save(path);
+    tt().store(board().key(), Move(Square::E2, Square::E4), 42, 3, search::TTBound::Exact, 0, 17);
+
+    ASSERT_TRUE(execute("setoption name EvalFile value " + path));
+    ASSERT_NE(network(), nullptr);
+    EXPECT_FALSE(tt().probe(board().key()).has_value());
+    EXPECT_EQ(options().eval_file.value, path);
+    EXPECT_NE(output.str().find("network loaded from " + path), std::string::npos);
+
+    ASSERT_TRUE(execute("go depth 2"));
+    thread_pool().wait();
+    EXPECT_NE(output.str().find("bestmove"), std::string::npos);
+
+    // A bad file leaves the loaded network and option in place.
+    EXPECT_TRUE(execute("setoption name EvalFile value " + path + ".missing"));
+    EXPECT_NE(output.str().find("error: cannot open network file"), std::string::npos);
+    EXPECT_NE(network(), nullptr);
+    EXPECT_EQ(options().eval_file.value, path);
+
+    EXPECT_TRUE(execute("setoption name EvalFile"));
+    EXPECT_EQ(network(), nullptr);
+    EXPECT_TRUE(options().eval_file.value.empty());
+    EXPECT_EQ(tt().evaluator(), search::tt_handcrafted_evaluator);
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(EngineOptionsTest, EvalFileCannotChangeTheEvaluatorOfASharedHash) {
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "latrunculi_engine_shared.nnue").string();
+    const std::string name = "latrunculi_engine_shared_eval_test";
+    nnue_test::random_network()->save(path);
+    search::TTMemory::remove_shared(name);
+
+    ASSERT_TRUE(execute("setoption name Hash value 2"));
+    ASSERT_TRUE(execute("setoption name SharedHash value " + name));
+    EXPECT_TRUE(execute("setoption name EvalFile value " + path));
+    EXPECT_NE(output.str().find("error: cannot change the evaluator of a shared hash"),
+              std::string::npos);
+    EXPECT_EQ(network(), nullptr);
+    EXPECT_TRUE(options().eval_file.value.empty());
+
+    search::TTMemory::remove_shared(name);
+    std::filesystem::remove(path);
 }
 
 struct SetOptionCase {
@@ -11,10 +11,24 @@ TEST(UciOptionsTest, SetUpdatesValuesAndReturnsOptionId) {
     EXPECT_EQ(options.set("THREADS", "2", true), uci::OptionId::Threads);
     EXPECT_EQ(options.set("pOnDeR", "ON", true), uci::OptionId::Ponder);
     EXPECT_EQ(options.set("clear hash", "", false), uci::OptionId::ClearHash);
+    EXPECT_EQ(options.set("hashfile", "tables/main.hash", true), uci::OptionId::HashFile);
+    EXPECT_EQ(options.set("Save Hash", "", false), uci::OptionId::SaveHash);
+    EXPECT_EQ(options.set("LOAD HASH", "", false), uci::OptionId::LoadHash);
+    EXPECT_EQ(options.set("SharedHash", "farm", true), uci::OptionId::SharedHash);
+    EXPECT_EQ(options.set("EVALFILE", "nets/main.nnue", true), uci::OptionId::EvalFile);
 
     EXPECT_EQ(options.hash.value, 16);
     EXPECT_EQ(options.threads.value, 2);
     EXPECT_TRUE(options.ponder.value);
+    EXPECT_EQ(options.hash_file.value, "tables/main.hash");
+    EXPECT_EQ(options.shared_hash.value, "farm");
+    EXPECT_EQ(options.eval_file.value, "nets/main.nnue");
+
+    EXPECT_EQ(options.set("sharedhash", "", false), uci::OptionId::SharedHash);
+    EXPECT_TRUE(options.shared_hash.value.empty());
+
+    EXPECT_EQ(options.set("evalfile", "", false), uci::OptionId::EvalFile);
+    EXPECT_TRUE(options.eval_file.value.empty());
 }
 
 TEST(UciOptionsTest, RejectsMalformedOptionValues) {
@@ -26,4 +40,7 @@ TEST(UciOptionsTest, RejectsMalformedOptionValues) {
     EXPECT_THROW(options.set("Ponder", "", false), std::invalid_argument);
     EXPECT_THROW(options.set("Clear Hash", "", true), std::invalid_argument);
     EXPECT_THROW(options.set("Clear Hash", "now", true), std::invalid_argument);
+    EXPECT_THROW(options.set("HashFile", "", false), std::invalid_argument);
+    EXPECT_THROW(options.set("Save Hash", "now", true), std::invalid_argument);
+    EXPECT_THROW(options.set("Load Hash", "now", true), std::invalid_argument);
 }
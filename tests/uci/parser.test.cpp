@@ -177,6 +177,16 @@ TEST(UciParserTest, ParsesDebugExtensionCommands) {
     EXPECT_EQ(command.arguments, "3");
 }
 
+TEST(UciParserTest, ParsesHashFileExtensionCommands) {
+    const auto save = parse_as<uci::ConsoleCommand>("savehash tables/main.hash");
+    EXPECT_EQ(save.name, uci::ConsoleCommand::Name::SaveHash);
+    EXPECT_EQ(save.arguments, "tables/main.hash");
+
+    const auto load = parse_as<uci::ConsoleCommand>("loadhash");
+    EXPECT_EQ(load.name, uci::ConsoleCommand::Name::LoadHash);
+    EXPECT_TRUE(load.arguments.empty());
+}
+
 TEST(UciParserTest, ParsesBoardDisplayAlias) {
     const auto command = parse_as<uci::ConsoleCommand>("d");
 
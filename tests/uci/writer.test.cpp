@@ -69,9 +69,17 @@ TEST_F(UciWriterTest, Identify) {
 
     EXPECT_EQ(default_table.capacity_mb(), static_cast<std::size_t>(options.hash.default_value));
     EXPECT_NE(oss.str().find("uciok"), std::string::npos);
-    EXPECT_NE(oss.str().find("option name Hash type spin default 32 min 1 max 2048"),
+    EXPECT_NE(oss.str().find("option name Hash type spin default 32 min 1 max 1048576"),
               std::string::npos);
     EXPECT_NE(oss.str().find("option name Clear Hash type button"), std::string::npos);
+    EXPECT_NE(oss.str().find("option name HashFile type string default <empty>"),
+              std::string::npos);
+    EXPECT_NE(oss.str().find("option name Save Hash type button"), std::string::npos);
+    EXPECT_NE(oss.str().find("option name Load Hash type button"), std::string::npos);
+    EXPECT_NE(oss.str().find("option name SharedHash type string default <empty>"),
+              std::string::npos);
+    EXPECT_NE(oss.str().find("option name EvalFile type string default <empty>"),
+              std::string::npos);
     EXPECT_NE(oss.str().find("option name Ponder type check default false"), std::string::npos);
     EXPECT_EQ(oss.str().find("option name Debug"), std::string::npos);
 }